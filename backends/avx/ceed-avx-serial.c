@@ -20,11 +20,16 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
 
   CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/avx/serial"), ceed, CEED_ERROR_BACKEND,
             "AVX backend cannot use resource: %s", resource);
-  CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
   CeedCallBackend(CeedInit("/cpu/self/opt/serial", &ceed_ref));
   CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
+  {
+    bool is_deterministic;
+
+    CeedCallBackend(CeedIsDeterministic(ceed_ref, &is_deterministic));
+    CeedCallBackend(CeedSetDeterministic(ceed, is_deterministic));
+  }
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Avx));
   return CEED_ERROR_SUCCESS;
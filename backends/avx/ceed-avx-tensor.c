@@ -10,12 +10,43 @@
 #include <immintrin.h>
 #include <stdbool.h>
 
+#ifdef __AVX512F__
+#ifdef CEED_F64_H
+#define rtype __m512d
+#define mtype __mmask8
+#define VLEN 8
+#define loadu _mm512_loadu_pd
+#define storeu _mm512_storeu_pd
+#define set1 _mm512_set1_pd
+#define loadu_mask(m, p) _mm512_maskz_loadu_pd((m), (p))
+#define storeu_mask(p, m, x) _mm512_mask_storeu_pd((p), (m), (x))
+// c += a * b
+#define fmadd(c, a, b) (c) = _mm512_fmadd_pd((a), (b), (c))
+#else
+#define rtype __m512
+#define mtype __mmask16
+#define VLEN 16
+#define loadu _mm512_loadu_ps
+#define storeu _mm512_storeu_ps
+#define set1 _mm512_set1_ps
+#define loadu_mask(m, p) _mm512_maskz_loadu_ps((m), (p))
+#define storeu_mask(p, m, x) _mm512_mask_storeu_ps((p), (m), (x))
+// c += a * b
+#define fmadd(c, a, b) (c) = _mm512_fmadd_ps((a), (b), (c))
+#endif
+// Mask of the first n lanes
+#define mask_n(n) ((mtype)((1u << (n)) - 1))
+#else
 #ifdef CEED_F64_H
 #define rtype __m256d
+#define mtype __m256i
+#define VLEN 4
 #define loadu _mm256_loadu_pd
 #define storeu _mm256_storeu_pd
-#define set _mm256_set_pd
 #define set1 _mm256_set1_pd
+#define loadu_mask(m, p) _mm256_maskload_pd((p), (m))
+#define storeu_mask(p, m, x) _mm256_maskstore_pd((p), (m), (x))
+#define mask_n(n) _mm256_set_epi64x(-((n) > 3), -((n) > 2), -((n) > 1), -((n) > 0))
 // c += a * b
 #ifdef __FMA__
 #define fmadd(c, a, b) (c) = _mm256_fmadd_pd((a), (b), (c))
@@ -23,19 +54,44 @@
 #define fmadd(c, a, b) (c) += _mm256_mul_pd((a), (b))
 #endif
 #else
-#define rtype __m128
-#define loadu _mm_loadu_ps
-#define storeu _mm_storeu_ps
-#define set _mm_set_ps
-#define set1 _mm_set1_ps
+#define rtype __m256
+#define mtype __m256i
+#define VLEN 8
+#define loadu _mm256_loadu_ps
+#define storeu _mm256_storeu_ps
+#define set1 _mm256_set1_ps
+#define loadu_mask(m, p) _mm256_maskload_ps((p), (m))
+#define storeu_mask(p, m, x) _mm256_maskstore_ps((p), (m), (x))
+#define mask_n(n) \
+  _mm256_set_epi32(-((n) > 7), -((n) > 6), -((n) > 5), -((n) > 4), -((n) > 3), -((n) > 2), -((n) > 1), -((n) > 0))
 // c += a * b
 #ifdef __FMA__
-#define fmadd(c, a, b) (c) = _mm_fmadd_ps((a), (b), (c))
+#define fmadd(c, a, b) (c) = _mm256_fmadd_ps((a), (b), (c))
 #else
-#define fmadd(c, a, b) (c) += _mm_mul_ps((a), (b))
+#define fmadd(c, a, b) (c) += _mm256_mul_ps((a), (b))
+#endif
 #endif
 #endif
 
+// Register tile sizes
+#define BLOCKED_JJ 4
+#define BLOCKED_CC (2 * VLEN)
+#define REMAINDER_JJ 8
+#define SINGLE_AA 4
+#define SINGLE_JJ (2 * VLEN)
+
+//------------------------------------------------------------------------------
+// Load n <= VLEN strided entries of t, zero filled
+//------------------------------------------------------------------------------
+static inline rtype CeedTensorContract_Avx_LoadT(const CeedScalar *restrict t, CeedInt stride, CeedInt n) {
+  if (stride == 1) return loadu_mask(mask_n(n), t);
+
+  CeedScalar t_lanes[VLEN] = {0.0};
+
+  for (CeedInt l = 0; l < n; l++) t_lanes[l] = t[l * stride];
+  return loadu(t_lanes);
+}
+
 //------------------------------------------------------------------------------
 // Blocked Tensor Contract
 //------------------------------------------------------------------------------
@@ -50,23 +106,23 @@ static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract, Ce
   }
 
   for (CeedInt a = 0; a < A; a++) {
-    // Blocks of 4 rows
+    // Blocks of JJ rows
     for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
       for (CeedInt c = 0; c < (C / CC) * CC; c += CC) {
-        rtype vv[JJ][CC / 4];  // Output tile to be held in registers
+        rtype vv[JJ][CC / VLEN];  // Output tile to be held in registers
         for (CeedInt jj = 0; jj < JJ; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) vv[jj][cc] = loadu(&v[(a * J + j + jj) * C + c + cc * 4]);
+          for (CeedInt cc = 0; cc < CC / VLEN; cc++) vv[jj][cc] = loadu(&v[(a * J + j + jj) * C + c + cc * VLEN]);
         }
         for (CeedInt b = 0; b < B; b++) {
           for (CeedInt jj = 0; jj < JJ; jj++) {  // unroll
             rtype tqv = set1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
-            for (CeedInt cc = 0; cc < CC / 4; cc++) {  // unroll
-              fmadd(vv[jj][cc], tqv, loadu(&u[(a * B + b) * C + c + cc * 4]));
+            for (CeedInt cc = 0; cc < CC / VLEN; cc++) {  // unroll
+              fmadd(vv[jj][cc], tqv, loadu(&u[(a * B + b) * C + c + cc * VLEN]));
             }
           }
         }
         for (CeedInt jj = 0; jj < JJ; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) storeu(&v[(a * J + j + jj) * C + c + cc * 4], vv[jj][cc]);
+          for (CeedInt cc = 0; cc < CC / VLEN; cc++) storeu(&v[(a * J + j + jj) * C + c + cc * VLEN], vv[jj][cc]);
         }
       }
     }
@@ -75,22 +131,22 @@ static inline int CeedTensorContract_Avx_Blocked(CeedTensorContract contract, Ce
 
     if (j < J) {
       for (CeedInt c = 0; c < (C / CC) * CC; c += CC) {
-        rtype vv[JJ][CC / 4];  // Output tile to be held in registers
+        rtype vv[JJ][CC / VLEN];  // Output tile to be held in registers
 
         for (CeedInt jj = 0; jj < J - j; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) vv[jj][cc] = loadu(&v[(a * J + j + jj) * C + c + cc * 4]);
+          for (CeedInt cc = 0; cc < CC / VLEN; cc++) vv[jj][cc] = loadu(&v[(a * J + j + jj) * C + c + cc * VLEN]);
         }
         for (CeedInt b = 0; b < B; b++) {
           for (CeedInt jj = 0; jj < J - j; jj++) {  // doesn't unroll
             rtype tqv = set1(t[(j + jj) * t_stride_0 + b * t_stride_1]);
 
-            for (CeedInt cc = 0; cc < CC / 4; cc++) {  // unroll
-              fmadd(vv[jj][cc], tqv, loadu(&u[(a * B + b) * C + c + cc * 4]));
+            for (CeedInt cc = 0; cc < CC / VLEN; cc++) {  // unroll
+              fmadd(vv[jj][cc], tqv, loadu(&u[(a * B + b) * C + c + cc * VLEN]));
             }
           }
         }
         for (CeedInt jj = 0; jj < J - j; jj++) {
-          for (CeedInt cc = 0; cc < CC / 4; cc++) storeu(&v[(a * J + j + jj) * C + c + cc * 4], vv[jj][cc]);
+          for (CeedInt cc = 0; cc < CC / VLEN; cc++) storeu(&v[(a * J + j + jj) * C + c + cc * VLEN], vv[jj][cc]);
         }
       }
     }
@@ -111,36 +167,40 @@ static inline int CeedTensorContract_Avx_Remainder(CeedTensorContract contract,
     t_stride_1 = J;
   }
 
-  const CeedInt J_break = J % JJ ? (J / JJ) * JJ : (J / JJ - 1) * JJ;
-
   for (CeedInt a = 0; a < A; a++) {
-    // Blocks of 4 columns
-    for (CeedInt c = (C / CC) * CC; c < C; c += 4) {
-      // Blocks of 4 rows
-      for (CeedInt j = 0; j < J_break; j += JJ) {
+    // Blocks of VLEN columns, masked past C
+    for (CeedInt c = (C / CC) * CC; c < C; c += VLEN) {
+      const mtype m = mask_n(CeedIntMin(VLEN, C - c));
+
+      // Blocks of JJ rows
+      for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
         rtype vv[JJ];  // Output tile to be held in registers
 
-        for (CeedInt jj = 0; jj < JJ; jj++) vv[jj] = loadu(&v[(a * J + j + jj) * C + c]);
+        for (CeedInt jj = 0; jj < JJ; jj++) vv[jj] = loadu_mask(m, &v[(a * J + j + jj) * C + c]);
         for (CeedInt b = 0; b < B; b++) {
-          rtype tqu;
+          const rtype tqu = loadu_mask(m, &u[(a * B + b) * C + c]);
 
-          if (C - c == 1) tqu = set(0.0, 0.0, 0.0, u[(a * B + b) * C + c + 0]);
-          else if (C - c == 2) tqu = set(0.0, 0.0, u[(a * B + b) * C + c + 1], u[(a * B + b) * C + c + 0]);
-          else if (C - c == 3) tqu = set(0.0, u[(a * B + b) * C + c + 2], u[(a * B + b) * C + c + 1], u[(a * B + b) * C + c + 0]);
-          else tqu = loadu(&u[(a * B + b) * C + c]);
           for (CeedInt jj = 0; jj < JJ; jj++) {  // unroll
             fmadd(vv[jj], tqu, set1(t[(j + jj) * t_stride_0 + b * t_stride_1]));
           }
         }
-        for (CeedInt jj = 0; jj < JJ; jj++) storeu(&v[(a * J + j + jj) * C + c], vv[jj]);
+        for (CeedInt jj = 0; jj < JJ; jj++) storeu_mask(&v[(a * J + j + jj) * C + c], m, vv[jj]);
       }
-    }
-    // Remainder of rows, all columns
-    for (CeedInt j = J_break; j < J; j++) {
-      for (CeedInt b = 0; b < B; b++) {
-        const CeedScalar tq = t[j * t_stride_0 + b * t_stride_1];
+      // Remainder of rows
+      const CeedInt j = (J / JJ) * JJ;
+
+      if (j < J) {
+        rtype vv[JJ];  // Output tile to be held in registers
+
+        for (CeedInt jj = 0; jj < J - j; jj++) vv[jj] = loadu_mask(m, &v[(a * J + j + jj) * C + c]);
+        for (CeedInt b = 0; b < B; b++) {
+          const rtype tqu = loadu_mask(m, &u[(a * B + b) * C + c]);
 
-        for (CeedInt c = (C / CC) * CC; c < C; c++) v[(a * J + j) * C + c] += tq * u[(a * B + b) * C + c];
+          for (CeedInt jj = 0; jj < J - j; jj++) {  // doesn't unroll
+            fmadd(vv[jj], tqu, set1(t[(j + jj) * t_stride_0 + b * t_stride_1]));
+          }
+        }
+        for (CeedInt jj = 0; jj < J - j; jj++) storeu_mask(&v[(a * J + j + jj) * C + c], m, vv[jj]);
       }
     }
   }
@@ -160,89 +220,70 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract, Cee
     t_stride_1 = J;
   }
 
-  // Blocks of 4 rows
-  for (CeedInt a = 0; a < (A / AA) * AA; a += AA) {
-    for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
-      rtype vv[AA][JJ / 4];  // Output tile to be held in registers
+  // Blocks of JJ columns
+  for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
+    rtype tqv[B][JJ / VLEN];  // Strided columns of t, shared by all rows
+
+    for (CeedInt b = 0; b < B; b++) {
+      for (CeedInt jj = 0; jj < JJ / VLEN; jj++) {
+        tqv[b][jj] = CeedTensorContract_Avx_LoadT(&t[(j + jj * VLEN) * t_stride_0 + b * t_stride_1], t_stride_0, VLEN);
+      }
+    }
+    // Blocks of AA rows
+    for (CeedInt a = 0; a < (A / AA) * AA; a += AA) {
+      rtype vv[AA][JJ / VLEN];  // Output tile to be held in registers
 
       for (CeedInt aa = 0; aa < AA; aa++) {
-        for (CeedInt jj = 0; jj < JJ / 4; jj++) vv[aa][jj] = loadu(&v[(a + aa) * J + j + jj * 4]);
+        for (CeedInt jj = 0; jj < JJ / VLEN; jj++) vv[aa][jj] = loadu(&v[(a + aa) * J + j + jj * VLEN]);
       }
       for (CeedInt b = 0; b < B; b++) {
-        for (CeedInt jj = 0; jj < JJ / 4; jj++) {  // unroll
-          rtype tqv = set(t[(j + jj * 4 + 3) * t_stride_0 + b * t_stride_1], t[(j + jj * 4 + 2) * t_stride_0 + b * t_stride_1],
-                          t[(j + jj * 4 + 1) * t_stride_0 + b * t_stride_1], t[(j + jj * 4 + 0) * t_stride_0 + b * t_stride_1]);
-
-          for (CeedInt aa = 0; aa < AA; aa++) {  // unroll
-            fmadd(vv[aa][jj], tqv, set1(u[(a + aa) * B + b]));
+        for (CeedInt jj = 0; jj < JJ / VLEN; jj++) {  // unroll
+          for (CeedInt aa = 0; aa < AA; aa++) {       // unroll
+            fmadd(vv[aa][jj], tqv[b][jj], set1(u[(a + aa) * B + b]));
           }
         }
       }
       for (CeedInt aa = 0; aa < AA; aa++) {
-        for (CeedInt jj = 0; jj < JJ / 4; jj++) storeu(&v[(a + aa) * J + j + jj * 4], vv[aa][jj]);
+        for (CeedInt jj = 0; jj < JJ / VLEN; jj++) storeu(&v[(a + aa) * J + j + jj * VLEN], vv[aa][jj]);
       }
     }
-  }
-  // Remainder of rows
-  const CeedInt a = (A / AA) * AA;
-
-  for (CeedInt j = 0; j < (J / JJ) * JJ; j += JJ) {
-    rtype vv[AA][JJ / 4];  // Output tile to be held in registers
+    // Remainder of rows
+    const CeedInt a = (A / AA) * AA;
 
-    for (CeedInt aa = 0; aa < A - a; aa++) {
-      for (CeedInt jj = 0; jj < JJ / 4; jj++) vv[aa][jj] = loadu(&v[(a + aa) * J + j + jj * 4]);
-    }
-    for (CeedInt b = 0; b < B; b++) {
-      for (CeedInt jj = 0; jj < JJ / 4; jj++) {  // unroll
-        rtype tqv = set(t[(j + jj * 4 + 3) * t_stride_0 + b * t_stride_1], t[(j + jj * 4 + 2) * t_stride_0 + b * t_stride_1],
-                        t[(j + jj * 4 + 1) * t_stride_0 + b * t_stride_1], t[(j + jj * 4 + 0) * t_stride_0 + b * t_stride_1]);
+    if (a < A) {
+      rtype vv[AA][JJ / VLEN];  // Output tile to be held in registers
 
-        for (CeedInt aa = 0; aa < A - a; aa++) {  // unroll
-          fmadd(vv[aa][jj], tqv, set1(u[(a + aa) * B + b]));
-        }
+      for (CeedInt aa = 0; aa < A - a; aa++) {
+        for (CeedInt jj = 0; jj < JJ / VLEN; jj++) vv[aa][jj] = loadu(&v[(a + aa) * J + j + jj * VLEN]);
       }
-    }
-    for (CeedInt aa = 0; aa < A - a; aa++) {
-      for (CeedInt jj = 0; jj < JJ / 4; jj++) storeu(&v[(a + aa) * J + j + jj * 4], vv[aa][jj]);
-    }
-  }
-  // Column remainder
-  const CeedInt A_break = A % AA ? (A / AA) * AA : (A / AA - 1) * AA;
-
-  // Blocks of 4 columns
-  for (CeedInt j = (J / JJ) * JJ; j < J; j += 4) {
-    // Blocks of 4 rows
-    for (CeedInt a = 0; a < A_break; a += AA) {
-      rtype vv[AA];  // Output tile to be held in registers
-
-      for (CeedInt aa = 0; aa < AA; aa++) vv[aa] = loadu(&v[(a + aa) * J + j]);
       for (CeedInt b = 0; b < B; b++) {
-        rtype tqv;
-
-        if (J - j == 1) {
-          tqv = set(0.0, 0.0, 0.0, t[(j + 0) * t_stride_0 + b * t_stride_1]);
-        } else if (J - j == 2) {
-          tqv = set(0.0, 0.0, t[(j + 1) * t_stride_0 + b * t_stride_1], t[(j + 0) * t_stride_0 + b * t_stride_1]);
-        } else if (J - 3 == j) {
-          tqv =
-              set(0.0, t[(j + 2) * t_stride_0 + b * t_stride_1], t[(j + 1) * t_stride_0 + b * t_stride_1], t[(j + 0) * t_stride_0 + b * t_stride_1]);
-        } else {
-          tqv = set(t[(j + 3) * t_stride_0 + b * t_stride_1], t[(j + 2) * t_stride_0 + b * t_stride_1], t[(j + 1) * t_stride_0 + b * t_stride_1],
-                    t[(j + 0) * t_stride_0 + b * t_stride_1]);
-        }
-        for (CeedInt aa = 0; aa < AA; aa++) {  // unroll
-          fmadd(vv[aa], tqv, set1(u[(a + aa) * B + b]));
+        for (CeedInt jj = 0; jj < JJ / VLEN; jj++) {  // unroll
+          for (CeedInt aa = 0; aa < A - a; aa++) {    // doesn't unroll
+            fmadd(vv[aa][jj], tqv[b][jj], set1(u[(a + aa) * B + b]));
+          }
         }
       }
-      for (CeedInt aa = 0; aa < AA; aa++) storeu(&v[(a + aa) * J + j], vv[aa]);
+      for (CeedInt aa = 0; aa < A - a; aa++) {
+        for (CeedInt jj = 0; jj < JJ / VLEN; jj++) storeu(&v[(a + aa) * J + j + jj * VLEN], vv[aa][jj]);
+      }
     }
   }
-  // Remainder of rows, all columns
-  for (CeedInt b = 0; b < B; b++) {
-    for (CeedInt j = (J / JJ) * JJ; j < J; j++) {
-      const CeedScalar tq = t[j * t_stride_0 + b * t_stride_1];
-
-      for (CeedInt a = A_break; a < A; a++) v[a * J + j] += tq * u[a * B + b];
+  // Column remainder, blocks of VLEN columns masked past J
+  for (CeedInt j = (J / JJ) * JJ; j < J; j += VLEN) {
+    const CeedInt num_j = CeedIntMin(VLEN, J - j);
+    const mtype   m     = mask_n(num_j);
+    rtype         tqv[B];  // Strided columns of t, shared by all rows
+
+    for (CeedInt b = 0; b < B; b++) tqv[b] = CeedTensorContract_Avx_LoadT(&t[j * t_stride_0 + b * t_stride_1], t_stride_0, num_j);
+    for (CeedInt a = 0; a < A; a += AA) {
+      const CeedInt num_a = CeedIntMin(AA, A - a);
+      rtype         vv[AA];  // Output tile to be held in registers
+
+      for (CeedInt aa = 0; aa < num_a; aa++) vv[aa] = loadu_mask(m, &v[(a + aa) * J + j]);
+      for (CeedInt b = 0; b < B; b++) {
+        for (CeedInt aa = 0; aa < num_a; aa++) fmadd(vv[aa], tqv[b], set1(u[(a + aa) * B + b]));
+      }
+      for (CeedInt aa = 0; aa < num_a; aa++) storeu_mask(&v[(a + aa) * J + j], m, vv[aa]);
     }
   }
   return CEED_ERROR_SUCCESS;
@@ -251,17 +292,18 @@ static inline int CeedTensorContract_Avx_Single(CeedTensorContract contract, Cee
 //------------------------------------------------------------------------------
 // Tensor Contract - Common Sizes
 //------------------------------------------------------------------------------
-static int CeedTensorContract_Avx_Blocked_4_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
-                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, 4, 8);
+static int CeedTensorContract_Avx_Blocked_Tile(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                               CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Blocked(contract, A, B, C, J, t, t_mode, add, u, v, BLOCKED_JJ, BLOCKED_CC);
 }
-static int CeedTensorContract_Avx_Remainder_8_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
-                                                CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, add, u, v, 8, 8);
+static int CeedTensorContract_Avx_Remainder_Tile(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                 const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+                                                 const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Remainder(contract, A, B, C, J, t, t_mode, add, u, v, REMAINDER_JJ, BLOCKED_CC);
 }
-static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
-                                             CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, 4, 8);
+static int CeedTensorContract_Avx_Single_Tile(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
+                                              CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  return CeedTensorContract_Avx_Single(contract, A, B, C, J, t, t_mode, add, u, v, SINGLE_AA, SINGLE_JJ);
 }
 
 //------------------------------------------------------------------------------
@@ -269,20 +311,18 @@ static int CeedTensorContract_Avx_Single_4_8(CeedTensorContract contract, CeedIn
 //------------------------------------------------------------------------------
 static int CeedTensorContractApply_Avx(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const CeedScalar *restrict t,
                                        CeedTransposeMode t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v) {
-  const CeedInt blk_size = 8;
-
   if (!add) {
     for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
   }
 
   if (C == 1) {
     // Serial C=1 Case
-    CeedTensorContract_Avx_Single_4_8(contract, A, B, C, J, t, t_mode, true, u, v);
+    CeedTensorContract_Avx_Single_Tile(contract, A, B, C, J, t, t_mode, true, u, v);
   } else {
-    // Blocks of 8 columns
-    if (C >= blk_size) CeedTensorContract_Avx_Blocked_4_8(contract, A, B, C, J, t, t_mode, true, u, v);
+    // Blocks of BLOCKED_CC columns
+    if (C >= BLOCKED_CC) CeedTensorContract_Avx_Blocked_Tile(contract, A, B, C, J, t, t_mode, true, u, v);
     // Remainder of columns
-    if (C % blk_size) CeedTensorContract_Avx_Remainder_8_8(contract, A, B, C, J, t, t_mode, true, u, v);
+    if (C % BLOCKED_CC) CeedTensorContract_Avx_Remainder_Tile(contract, A, B, C, J, t, t_mode, true, u, v);
   }
   return CEED_ERROR_SUCCESS;
 }
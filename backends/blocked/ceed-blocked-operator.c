@@ -10,15 +10,20 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+#include "../ref/ceed-ref.h"
 #include "ceed-blocked.h"
 
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, CeedInt *e_data_out_indices,
-                                           bool *apply_add_basis, const CeedInt block_size, CeedElemRestriction *block_rstr, CeedVector *e_vecs_full,
-                                           CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
+                                           bool *apply_add_basis, const CeedInt block_size, const CeedInt num_threads, CeedBasis *field_basis,
+                                           CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs,
+                                           CeedInt start_e, CeedInt num_fields, CeedInt Q) {
   Ceed                ceed;
   CeedSize            e_size, q_size;
   CeedInt             num_comp, size, P;
@@ -113,27 +118,30 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
       case CEED_EVAL_NONE:
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
         q_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        for (CeedInt t = 0; t < num_threads; t++) CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i + t * CEED_FIELD_MAX]));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &field_basis[i + start_e]));
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
-        CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedBasisGetNumNodes(field_basis[i + start_e], &P));
+        CeedCallBackend(CeedBasisGetNumComponents(field_basis[i + start_e], &num_comp));
         e_size = (CeedSize)P * num_comp * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
         q_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
+        for (CeedInt t = 0; t < num_threads; t++) {
+          CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i + t * CEED_FIELD_MAX]));
+          CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i + t * CEED_FIELD_MAX]));
+        }
         break;
       case CEED_EVAL_WEIGHT:  // Only on input fields
         CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
         q_size = (CeedSize)Q * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs[i]));
+        for (CeedInt t = 0; t < num_threads; t++) {
+          CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i + t * CEED_FIELD_MAX]));
+          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs[i + t * CEED_FIELD_MAX]));
+        }
         CeedCallBackend(CeedBasisDestroy(&basis));
         break;
     }
@@ -153,7 +161,9 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+          for (CeedInt t = 0; t < num_threads; t++) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i + t * CEED_FIELD_MAX], &e_vecs[j + t * CEED_FIELD_MAX]));
+          }
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j] = true;
         }
@@ -177,7 +187,9 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+          for (CeedInt t = 0; t < num_threads; t++) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i + t * CEED_FIELD_MAX], &e_vecs[j + t * CEED_FIELD_MAX]));
+          }
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j]          = true;
           apply_add_basis[i]    = true;
@@ -217,31 +229,54 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
 
+#ifdef _OPENMP
+  impl->num_threads = omp_get_max_threads();
+#else
+  impl->num_threads = 1;
+#endif
+  const CeedInt num_threads = impl->num_threads;
+
   // Allocate
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->basis));
 
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_out_indices));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->apply_add_basis_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX * num_threads, &impl->e_vecs_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX * num_threads, &impl->e_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX * num_threads, &impl->q_vecs_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX * num_threads, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX * num_threads, &impl->l_vecs_out));
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
   // Set up infield and outfield pointer arrays
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, true, impl->skip_rstr_in, NULL, NULL, block_size, impl->block_rstr, impl->e_vecs_full,
-                                                  impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, true, impl->skip_rstr_in, NULL, NULL, block_size, num_threads, impl->basis,
+                                                  impl->block_rstr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
   // Outfields
   CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out, block_size,
-                                                  impl->block_rstr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields,
-                                                  num_output_fields, Q));
+                                                  num_threads, impl->basis, impl->block_rstr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
+                                                  num_input_fields, num_output_fields, Q));
+
+  // Per thread views of output L-vectors, restricted into block by block
+  if (num_threads > 1) {
+    Ceed ceed_parent;
+
+    CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedSize l_size;
+
+      if (impl->skip_rstr_out[i]) continue;
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(impl->block_rstr[i + num_input_fields], &l_size));
+      for (CeedInt t = 0; t < num_threads; t++) CeedCallBackend(CeedVectorCreate(ceed_parent, l_size, &impl->l_vecs_out[i + t * CEED_FIELD_MAX]));
+    }
+  }
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -255,7 +290,9 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
     if (in_mode == CEED_EVAL_NONE && out_mode == CEED_EVAL_NONE) {
       impl->is_identity_rstr_op = true;
     } else {
-      CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[0], &impl->q_vecs_out[0]));
+      for (CeedInt t = 0; t < num_threads; t++) {
+        CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[t * CEED_FIELD_MAX], &impl->q_vecs_out[t * CEED_FIELD_MAX]));
+      }
     }
   }
 
@@ -305,12 +342,11 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields, Ceed
 //------------------------------------------------------------------------------
 static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
                                                  CeedInt num_input_fields, CeedInt block_size, bool skip_active,
-                                                 CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Blocked *impl) {
+                                                 CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedVector *e_vecs_in, CeedVector *q_vecs_in,
+                                                 CeedOperator_Blocked *impl) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    CeedInt      elem_size, size, num_comp;
+    CeedEvalMode eval_mode;
 
     // Skip active input
     if (skip_active) {
@@ -323,26 +359,22 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunc
       if (is_active) continue;
     }
 
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    // Get eval_mode, size
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedElemRestrictionGetElementSize(impl->block_rstr[i], &elem_size));
+        CeedCallBackend(CeedBasisGetNumComponents(impl->basis[i], &num_comp));
+        CeedCallBackend(CeedVectorSetArray(e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+        CeedCallBackend(CeedBasisApply(impl->basis[i], block_size, CEED_NOTRANSPOSE, eval_mode, e_vecs_in[i], q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
@@ -354,19 +386,16 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunc
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                                  CeedInt block_size, CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis,
-                                                  CeedOperator op, CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Blocked *impl) {
+static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedInt block_size,
+                                                  CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis, CeedOperator op,
+                                                  CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedVector *e_vecs_out, CeedVector *q_vecs_out,
+                                                  CeedOperator_Blocked *impl) {
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    CeedInt             elem_size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
-
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    CeedInt      elem_size, num_comp;
+    CeedEvalMode eval_mode;
+    CeedBasis    basis = impl->basis[i + num_input_fields];
+
+    // Get eval_mode
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     // Basis action
     switch (eval_mode) {
@@ -376,16 +405,15 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFun
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
+        CeedCallBackend(CeedElemRestrictionGetElementSize(impl->block_rstr[i + num_input_fields], &elem_size));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+        CeedCallBackend(CeedVectorSetArray(e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
                                            &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -424,14 +452,74 @@ static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields, Ce
   return CEED_ERROR_SUCCESS;
 }
 
+#ifdef _OPENMP
+//------------------------------------------------------------------------------
+// Operator Apply for a Single Element Block on a Single Thread
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddBlock_Blocked(CeedInt t, CeedInt b, CeedInt Q, CeedInt block_size, CeedQFunctionField *qf_input_fields,
+                                             CeedQFunctionField *qf_output_fields, CeedInt num_input_fields, CeedInt num_output_fields,
+                                             CeedQFunctionUser f, void *ctx_data, CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator op,
+                                             CeedOperator_Blocked *impl, CeedRequest *request) {
+  const CeedInt e          = b * block_size;
+  CeedVector   *e_vecs_in  = &impl->e_vecs_in[t * CEED_FIELD_MAX], *e_vecs_out = &impl->e_vecs_out[t * CEED_FIELD_MAX];
+  CeedVector   *q_vecs_in  = &impl->q_vecs_in[t * CEED_FIELD_MAX], *q_vecs_out = &impl->q_vecs_out[t * CEED_FIELD_MAX];
+  CeedVector   *l_vecs_out = &impl->l_vecs_out[t * CEED_FIELD_MAX];
+
+  // Output pointers
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedInt      size;
+    CeedEvalMode eval_mode;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_NONE) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+      CeedCallBackend(CeedVectorSetArray(q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+    }
+  }
+
+  // Input basis apply
+  CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, NULL, num_input_fields, block_size, false, e_data_full, e_vecs_in, q_vecs_in,
+                                                 impl));
+
+  // Q function, called directly as the QFunction backend data is shared between threads
+  if (!impl->is_identity_qf) {
+    const CeedScalar *q_data_in[CEED_FIELD_MAX];
+    CeedScalar       *q_data_out[CEED_FIELD_MAX];
+
+    for (CeedInt i = 0; i < num_input_fields; i++) CeedCallBackend(CeedVectorGetArrayRead(q_vecs_in[i], CEED_MEM_HOST, &q_data_in[i]));
+    for (CeedInt i = 0; i < num_output_fields; i++) CeedCallBackend(CeedVectorGetArrayWrite(q_vecs_out[i], CEED_MEM_HOST, &q_data_out[i]));
+    CeedCallBackend(f(ctx_data, Q * block_size, q_data_in, q_data_out));
+    for (CeedInt i = 0; i < num_input_fields; i++) CeedCallBackend(CeedVectorRestoreArrayRead(q_vecs_in[i], &q_data_in[i]));
+    for (CeedInt i = 0; i < num_output_fields; i++) CeedCallBackend(CeedVectorRestoreArray(q_vecs_out[i], &q_data_out[i]));
+  }
+
+  // Output basis apply
+  CeedCallBackend(CeedOperatorOutputBasis_Blocked(e, Q, qf_output_fields, block_size, num_input_fields, num_output_fields, impl->apply_add_basis_out,
+                                                  op, e_data_full, e_vecs_out, q_vecs_out, impl));
+
+  // Output restriction, no other block of this color touches the same L-vector entries
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedEvalMode eval_mode;
+
+    if (impl->skip_rstr_out[i]) continue;
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i + num_input_fields], b, CEED_TRANSPOSE,
+                                                  eval_mode == CEED_EVAL_NONE ? q_vecs_out[i] : e_vecs_out[i], l_vecs_out[i], request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+#endif
+
 //------------------------------------------------------------------------------
 // Operator Apply
 //------------------------------------------------------------------------------
 static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                  use_threads = false;
   CeedInt               Q, num_input_fields, num_output_fields, num_elem, size;
   const CeedInt         block_size = 8;
   CeedEvalMode          eval_mode;
   CeedScalar           *e_data_full[2 * CEED_FIELD_MAX] = {0};
+  CeedVector            out_vecs[CEED_FIELD_MAX]         = {0};
   CeedQFunctionField   *qf_input_fields, *qf_output_fields;
   CeedQFunction         qf;
   CeedOperatorField    *op_input_fields, *op_output_fields;
@@ -467,48 +555,152 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
     }
   }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
-    // Output pointers
+  // Output vectors
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedVector vec;
+
+    if (impl->skip_rstr_out[i]) continue;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    out_vecs[i] = vec == CEED_VECTOR_ACTIVE ? out_vec : vec;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
+#ifdef _OPENMP
+  // Colors of element blocks are split between threads unless already in a parallel region
+  CeedInt        num_colors    = 0;
+  const CeedInt *color_offsets = NULL, *color_blocks = NULL;
+
+  use_threads = impl->num_threads > 1 && num_blocks > 1 && !omp_in_parallel();
+  if (use_threads) {
+    bool                 is_writable;
+    CeedInt              rstr_index = -1;
+    CeedElemRestriction  rstr_color = NULL;
+    CeedQFunctionContext ctx;
+
+    // Writable contexts may be modified by the user QFunction
+    CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+    CeedCallBackend(CeedQFunctionIsContextWritable(qf, &is_writable));
+    if (ctx && is_writable) use_threads = false;
+    // The active input must not also be written to, and one coloring must hold for every output
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedElemRestriction rstr;
+
+      if (!out_vecs[i]) continue;
+      use_threads = use_threads && out_vecs[i] != in_vec;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+      if (!rstr_color) {
+        CeedCallBackend(CeedElemRestrictionReferenceCopy(rstr, &rstr_color));
+        rstr_index = i;
+      }
+      use_threads = use_threads && rstr == rstr_color;
+      CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&rstr_color));
+    if (use_threads && rstr_index >= 0) {
+      CeedCallBackend(CeedElemRestrictionGetColoring(impl->block_rstr[rstr_index + num_input_fields], &num_colors, &color_offsets, &color_blocks));
+      use_threads = num_colors < num_blocks;
+    }
+  }
+#endif
+
+  if (use_threads) {
+#ifdef _OPENMP
+    int               ierr        = CEED_ERROR_SUCCESS;
+    void             *ctx_data    = NULL;
+    CeedInt           event;
+    const CeedInt     num_threads = impl->num_threads;
+    CeedScalar       *out_arrays[CEED_FIELD_MAX] = {0};
+    CeedQFunctionUser f;
+
+    CeedCallBackend(CeedQFunctionSetImmutable(qf));
+    CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+    CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+
+    // Get output L-vector arrays, shared by all threads
     for (CeedInt i = 0; i < num_output_fields; i++) {
-      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-      if (eval_mode == CEED_EVAL_NONE) {
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+      if (!out_vecs[i]) continue;
+      for (CeedInt j = 0; j < i; j++) {
+        if (out_vecs[j] == out_vecs[i]) out_arrays[i] = out_arrays[j];
       }
+      if (!out_arrays[i]) CeedCallBackend(CeedVectorGetArray(out_vecs[i], CEED_MEM_HOST, &out_arrays[i]));
     }
 
-    // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, false, e_data_full, impl));
+    // Loop through colors, element blocks of one color are split between threads
+    //   Profiling events inside the parallel region are recorded per thread and merged afterwards
+    CeedCallBackend(CeedProfileEventBegin(CeedOperatorReturnCeed(op), "CeedOperatorApply (threaded elements)", NULL, 0, &event));
+    CeedCallBackend(CeedProfileThreadsBegin(CeedOperatorReturnCeed(op), num_threads));
+    CeedPragmaOMP(parallel num_threads(num_threads)) {
+      const CeedInt t          = omp_get_thread_num();
+      CeedVector   *l_vecs_out = &impl->l_vecs_out[t * CEED_FIELD_MAX];
+      int           ierr_t     = CEED_ERROR_SUCCESS;
+
+      for (CeedInt i = 0; i < num_output_fields && ierr_t == CEED_ERROR_SUCCESS; i++) {
+        if (out_vecs[i]) ierr_t = CeedVectorSetArray(l_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, out_arrays[i]);
+      }
+      for (CeedInt c = 0; c < num_colors; c++) {
+        CeedPragmaOMP(for schedule(static)) for (CeedInt k = color_offsets[c]; k < color_offsets[c + 1]; k++) {
+          if (ierr_t != CEED_ERROR_SUCCESS) continue;
+          ierr_t = CeedOperatorApplyAddBlock_Blocked(t, color_blocks[k], Q, block_size, qf_input_fields, qf_output_fields, num_input_fields,
+                                                     num_output_fields, f, ctx_data, e_data_full, op, impl, request);
+        }
+      }
+      for (CeedInt i = 0; i < num_output_fields && ierr_t == CEED_ERROR_SUCCESS; i++) {
+        if (out_vecs[i]) ierr_t = CeedVectorTakeArray(l_vecs_out[i], CEED_MEM_HOST, NULL);
+      }
+      if (ierr_t != CEED_ERROR_SUCCESS) {
+        CeedPragmaCritical(CeedOperatorApplyAdd_Blocked) ierr = ierr_t;
+      }
+    }
+    CeedCallBackend(CeedProfileThreadsEnd(CeedOperatorReturnCeed(op)));
+    CeedCallBackend(CeedProfileEventEnd(CeedOperatorReturnCeed(op), event, NULL));
+
+    // Restore L-vector and E-vector arrays
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      bool is_restored = !out_vecs[i];
 
-    // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      for (CeedInt j = 0; j < i; j++) is_restored = is_restored || out_vecs[j] == out_vecs[i];
+      if (!is_restored) CeedCallBackend(CeedVectorRestoreArray(out_vecs[i], &out_arrays[i]));
+      if (out_vecs[i]) CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
     }
+    CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+    CeedCallBackend(ierr);
+#endif
+  } else {
+    // Loop through elements
+    for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+      // Output pointers
+      for (CeedInt i = 0; i < num_output_fields; i++) {
+        CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+        if (eval_mode == CEED_EVAL_NONE) {
+          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+          CeedCallBackend(
+              CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+        }
+      }
 
-    // Output basis apply
-    CeedCallBackend(CeedOperatorOutputBasis_Blocked(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
-                                                    impl->apply_add_basis_out, op, e_data_full, impl));
-  }
+      // Input basis apply
+      CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, false, e_data_full,
+                                                     impl->e_vecs_in, impl->q_vecs_in, impl));
 
-  // Output restriction
-  for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool       is_active;
-    CeedVector vec;
+      // Q function
+      if (!impl->is_identity_qf) {
+        CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      }
 
-    if (impl->skip_rstr_out[i]) continue;
-    // Restore evec
-    CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    // Active
-    if (is_active) vec = out_vec;
-    // Restrict
-    CeedCallBackend(
-        CeedElemRestrictionApply(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+      // Output basis apply
+      CeedCallBackend(CeedOperatorOutputBasis_Blocked(e, Q, qf_output_fields, block_size, num_input_fields, num_output_fields,
+                                                      impl->apply_add_basis_out, op, e_data_full, impl->e_vecs_out, impl->q_vecs_out, impl));
+    }
+
+    // Output restriction
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      if (impl->skip_rstr_out[i]) continue;
+      // Restore evec
+      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
+      // Restrict
+      CeedCallBackend(CeedElemRestrictionApply(impl->block_rstr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs],
+                                               out_vecs[i], request));
+    }
   }
 
   // Restore input arrays
@@ -517,42 +709,16 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
 }
 
 //------------------------------------------------------------------------------
-// Core code for assembling linear QFunction
+// Count Active Fields for Linear QFunction Assembly
 //------------------------------------------------------------------------------
-static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator op, bool build_objects, CeedVector *assembled,
-                                                                  CeedElemRestriction *rstr, CeedRequest *request) {
-  Ceed                  ceed;
-  CeedInt               qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
-  const CeedInt         block_size = 8;
-  CeedScalar           *l_vec_array;
-  CeedScalar           *e_data_full[2 * CEED_FIELD_MAX] = {0};
-  CeedQFunctionField   *qf_input_fields, *qf_output_fields;
-  CeedQFunction         qf;
-  CeedOperatorField    *op_input_fields, *op_output_fields;
-  CeedOperator_Blocked *impl;
-
-  CeedCallBackend(CeedOperatorGetData(op, &impl));
-  qf_size_in                     = impl->qf_size_in;
-  qf_size_out                    = impl->qf_size_out;
-  CeedVector          l_vec      = impl->qf_l_vec;
-  CeedElemRestriction block_rstr = impl->qf_block_rstr;
+static inline int CeedOperatorLinearAssembleQFunctionSizes_Blocked(CeedOperator op, CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+                                                                   CeedOperatorField *op_input_fields, CeedInt num_output_fields,
+                                                                   CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+                                                                   CeedOperator_Blocked *impl) {
+  Ceed    ceed;
+  CeedInt qf_size_in = impl->qf_size_in, qf_size_out = impl->qf_size_out;
 
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
-
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Blocked(op));
-
-  // Check for restriction only operator
-  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
-
-  // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -564,7 +730,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
       CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
         qf_size_in += field_size;
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -573,6 +738,15 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
     impl->qf_size_in = qf_size_in;
   }
 
+  // Clear active input Qvecs, which hold basis output after operator application
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
   // Count number of active output fields
   if (qf_size_out == 0) {
     for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -590,6 +764,121 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
     CeedCheck(qf_size_out > 0, ceed, CEED_ERROR_BACKEND, "Cannot assemble QFunction without active inputs and outputs");
     impl->qf_size_out = qf_size_out;
   }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Single Element Block
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionElementBlock_Blocked(CeedInt Q, CeedInt block_size, CeedQFunction qf,
+                                                                          CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                                          CeedInt num_input_fields, CeedQFunctionField *qf_output_fields,
+                                                                          CeedOperatorField *op_output_fields, CeedInt num_output_fields,
+                                                                          CeedOperator_Blocked *impl, CeedScalar *assembled_array) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool       is_active;
+    CeedInt    field_size;
+    CeedVector vec;
+
+    // Check if active input
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    if (!is_active) continue;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
+    for (CeedInt field = 0; field < field_size; field++) {
+      // Set current portion of input to 1.0
+      {
+        CeedScalar *array;
+
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 1.0;
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+      }
+
+      if (!impl->is_identity_qf) {
+        // Set Outputs
+        for (CeedInt out = 0; out < num_output_fields; out++) {
+          CeedInt    field_size;
+          CeedVector vec;
+
+          // Get output vector
+          CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+          // Check if active output
+          if (vec == CEED_VECTOR_ACTIVE) {
+            CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, assembled_array));
+            CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
+            assembled_array += field_size * Q * block_size;  // Advance the pointer by the size of the output
+          }
+          CeedCallBackend(CeedVectorDestroy(&vec));
+        }
+        // Apply QFunction
+        CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      } else {
+        CeedInt           field_size;
+        const CeedScalar *array;
+
+        // Copy Identity Outputs
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
+        CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < field_size * Q * block_size; j++) assembled_array[j] = array[j];
+        CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
+        assembled_array += field_size * Q * block_size;
+      }
+      // Reset input to 0.0
+      {
+        CeedScalar *array;
+
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 0.0;
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for assembling linear QFunction
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator op, bool build_objects, CeedVector *assembled,
+                                                                  CeedElemRestriction *rstr, CeedRequest *request) {
+  Ceed                  ceed;
+  CeedInt               qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
+  const CeedInt         block_size = 8;
+  CeedScalar           *l_vec_array;
+  CeedScalar           *e_data_full[2 * CEED_FIELD_MAX] = {0};
+  CeedQFunctionField   *qf_input_fields, *qf_output_fields;
+  CeedQFunction         qf;
+  CeedOperatorField    *op_input_fields, *op_output_fields;
+  CeedOperator_Blocked *impl;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedVector          l_vec      = impl->qf_l_vec;
+  CeedElemRestriction block_rstr = impl->qf_block_rstr;
+
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  const CeedInt num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Blocked(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+
+  // Count number of active input and output fields
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSizes_Blocked(op, num_input_fields, qf_input_fields, op_input_fields, num_output_fields,
+                                                                   qf_output_fields, op_output_fields, impl));
+  qf_size_in  = impl->qf_size_in;
+  qf_size_out = impl->qf_size_out;
 
   // Setup Lvec
   if (!l_vec) {
@@ -624,69 +913,13 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
   // Loop through elements
   for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, true, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, true, e_data_full,
+                                                   impl->e_vecs_in, impl->q_vecs_in, impl));
 
     // Assemble QFunction
-    for (CeedInt i = 0; i < num_input_fields; i++) {
-      bool       is_active;
-      CeedInt    field_size;
-      CeedVector vec;
-
-      // Check if active input
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (!is_active) continue;
-      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-      for (CeedInt field = 0; field < field_size; field++) {
-        // Set current portion of input to 1.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 1.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-
-        if (!impl->is_identity_qf) {
-          // Set Outputs
-          for (CeedInt out = 0; out < num_output_fields; out++) {
-            CeedInt    field_size;
-            CeedVector vec;
-
-            // Get output vector
-            CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-            // Check if active output
-            if (vec == CEED_VECTOR_ACTIVE) {
-              CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, l_vec_array));
-              CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
-              l_vec_array += field_size * Q * block_size;  // Advance the pointer by the size of the output
-            }
-            CeedCallBackend(CeedVectorDestroy(&vec));
-          }
-          // Apply QFunction
-          CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
-        } else {
-          CeedInt           field_size;
-          const CeedScalar *array;
-
-          // Copy Identity Outputs
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
-          CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < field_size * Q * block_size; j++) l_vec_array[j] = array[j];
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
-          l_vec_array += field_size * Q * block_size;
-        }
-        // Reset input to 0.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 0.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-      }
-    }
+    CeedCallBackend(CeedOperatorLinearAssembleQFunctionElementBlock_Blocked(Q, block_size, qf, qf_input_fields, op_input_fields, num_input_fields,
+                                                                            qf_output_fields, op_output_fields, num_output_fields, impl,
+                                                                            &l_vec_array[(CeedSize)e * Q * qf_size_in * qf_size_out]));
   }
 
   // Un-set output Qvecs to prevent accidental overwrite of Assembled
@@ -727,6 +960,114 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Blocked(CeedOperator op, Ce
   return CeedOperatorLinearAssembleQFunctionCore_Blocked(op, false, &assembled, &rstr, request);
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Block of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionBlock_Blocked(CeedOperator op, CeedInt e_start, CeedInt num_elem_block, void *ctx,
+                                                            CeedScalar *assembled_block, CeedRequest *request) {
+  const CeedInt                 block_size = 8;
+  CeedInt                       Q, num_input_fields, num_output_fields;
+  CeedQFunctionField           *qf_input_fields, *qf_output_fields;
+  CeedQFunction                 qf;
+  CeedOperatorField            *op_input_fields, *op_output_fields;
+  CeedOperator_Blocked         *impl;
+  CeedOperatorDiagonal_Blocked *data = ctx;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Input Evecs and Restriction
+  if (!data->is_setup) {
+    CeedCallBackend(
+        CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, NULL, true, data->e_data_full, impl, request));
+    data->is_setup = true;
+  }
+
+  // Input basis apply
+  CeedCallBackend(CeedOperatorInputBasis_Blocked(e_start, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, true, data->e_data_full,
+                                                 impl->e_vecs_in, impl->q_vecs_in, impl));
+
+  // Assemble QFunction
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionElementBlock_Blocked(Q, block_size, qf, qf_input_fields, op_input_fields, num_input_fields,
+                                                                          qf_output_fields, op_output_fields, num_output_fields, impl,
+                                                                          assembled_block));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for assembling operator diagonal or point block diagonal
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleAddDiagonalCore_Blocked(CeedOperator op, bool is_point_block, CeedVector assembled,
+                                                                    CeedRequest *request) {
+  Ceed                         ceed;
+  const CeedInt                block_size = 8;
+  CeedInt                      Q, num_input_fields, num_output_fields;
+  CeedQFunctionField          *qf_input_fields, *qf_output_fields;
+  CeedQFunction                qf;
+  CeedOperatorField           *op_input_fields, *op_output_fields;
+  CeedOperator_Blocked        *impl;
+  CeedOperatorDiagonal_Blocked data = {false, {NULL}};
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Blocked(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Count number of active input and output fields
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSizes_Blocked(op, num_input_fields, qf_input_fields, op_input_fields, num_output_fields,
+                                                                   qf_output_fields, op_output_fields, impl));
+
+  // Assemble diagonal one element block at a time
+  {
+    const CeedInt layout_block[3] = {block_size, Q * block_size, 1};
+
+    CeedCallBackend(CeedOperatorLinearAssembleAddDiagonalByBlock(op, block_size, layout_block, CeedOperatorLinearAssembleQFunctionBlock_Blocked,
+                                                                 &data, is_point_block, assembled, request));
+  }
+  if (!data.is_setup) return CEED_ERROR_SUCCESS;
+
+  // Un-set output Qvecs to prevent accidental overwrite of assembled data
+  if (!impl->is_identity_qf) {
+    for (CeedInt out = 0; out < num_output_fields; out++) {
+      CeedVector vec;
+
+      // Check if active output
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
+      CeedCallBackend(CeedVectorDestroy(&vec));
+    }
+  }
+
+  // Restore input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, true, data.e_data_full, impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddDiagonal_Blocked(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Blocked(op, false, assembled, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Point Block Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Blocked(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Blocked(op, true, assembled, request);
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -742,24 +1083,29 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
     CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+    CeedCallBackend(CeedBasisDestroy(&impl->basis[i]));
   }
   CeedCallBackend(CeedFree(&impl->block_rstr));
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  CeedCallBackend(CeedFree(&impl->basis));
   CeedCallBackend(CeedFree(&impl->input_states));
 
-  for (CeedInt i = 0; i < impl->num_inputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i + t * CEED_FIELD_MAX]));
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i + t * CEED_FIELD_MAX]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i + t * CEED_FIELD_MAX]));
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i + t * CEED_FIELD_MAX]));
+      CeedCallBackend(CeedVectorDestroy(&impl->l_vecs_out[i + t * CEED_FIELD_MAX]));
+    }
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_in));
   CeedCallBackend(CeedFree(&impl->q_vecs_in));
-
-  for (CeedInt i = 0; i < impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
-  }
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
+  CeedCallBackend(CeedFree(&impl->l_vecs_out));
 
   // QFunction assembly data
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
@@ -781,7 +1127,12 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   CeedCallBackend(CeedOperatorSetData(op, impl));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonal_Blocked));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddPointBlockDiagonal", CeedOperatorLinearAssembleAddPointBlockDiagonal_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddElementMatrices", CeedOperatorApplyAddElementMatrices_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddFDMElementInverse", CeedOperatorApplyAddFDMElementInverse_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Blocked));
   return CEED_ERROR_SUCCESS;
 }
@@ -21,15 +21,22 @@ typedef struct {
   CeedInt             *e_data_out_indices;
   uint64_t            *input_states; /* State counter of inputs */
   CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
+  CeedVector          *e_vecs_in;    /* Element block input E-vectors, CEED_FIELD_MAX per thread  */
+  CeedVector          *e_vecs_out;   /* Element block output E-vectors, CEED_FIELD_MAX per thread */
+  CeedVector          *q_vecs_in;    /* Element block input Q-vectors, CEED_FIELD_MAX per thread  */
+  CeedVector          *q_vecs_out;   /* Element block output Q-vectors, CEED_FIELD_MAX per thread */
+  CeedVector          *l_vecs_out;   /* Per thread views of output L-vectors, CEED_FIELD_MAX per thread */
+  CeedBasis           *basis;        /* Field bases, inputs followed by outputs */
   CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
-  CeedInt              num_inputs, num_outputs;
+  CeedInt              num_inputs, num_outputs, num_threads;
   CeedInt              qf_size_in, qf_size_out;
   CeedVector           qf_l_vec;
   CeedElemRestriction  qf_block_rstr;
 } CeedOperator_Blocked;
 
+typedef struct {
+  bool        is_setup;                        /* Input E-vectors are set up when the first element block is assembled */
+  CeedScalar *e_data_full[2 * CEED_FIELD_MAX]; /* Input E-vector arrays */
+} CeedOperatorDiagonal_Blocked;
+
 CEED_INTERN int CeedOperatorCreate_Blocked(CeedOperator op);
@@ -10,17 +10,22 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
+#include "../ref/ceed-ref.h"
 #include "ceed-opt.h"
 
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, bool *apply_add_basis,
-                                       const CeedInt block_size, CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs,
-                                       CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
+                                       const CeedInt block_size, const CeedInt num_threads, bool *is_active, CeedBasis *field_basis,
+                                       CeedElemRestriction *block_rstr, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs,
+                                       CeedInt start_e, CeedInt num_fields, CeedInt Q) {
   Ceed                ceed;
-  CeedSize            e_size, q_size;
+  CeedSize            e_size = 0, q_size = 0;
   CeedInt             num_comp, size, P;
   CeedQFunctionField *qf_fields;
   CeedOperatorField  *op_fields;
@@ -43,8 +48,12 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
   // Loop over fields
   for (CeedInt i = 0; i < num_fields; i++) {
     CeedEvalMode eval_mode;
-    CeedBasis    basis;
+    CeedVector   vec;
+    CeedBasis    basis = NULL;
 
+    CeedCallBackend(CeedOperatorFieldGetVector(op_fields[i], &vec));
+    is_active[i + start_e] = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
     if (eval_mode != CEED_EVAL_WEIGHT) {
       Ceed                ceed_rstr;
@@ -113,34 +122,39 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
       case CEED_EVAL_NONE:
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
         e_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
         q_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &field_basis[i + start_e]));
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
-        CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedBasisGetNumNodes(field_basis[i + start_e], &P));
+        CeedCallBackend(CeedBasisGetNumComponents(field_basis[i + start_e], &num_comp));
         e_size = (CeedSize)P * num_comp * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
         q_size = (CeedSize)Q * size * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
         break;
       case CEED_EVAL_WEIGHT:  // Only on input fields
         CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        e_size = 0;
         q_size = (CeedSize)Q * block_size;
-        CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[i]));
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
     }
-    // Initialize E-vec arrays
-    if (e_vecs[i]) CeedCallBackend(CeedVectorSetValue(e_vecs[i], 0.0));
+    // Element block scratch for each thread
+    for (CeedInt t = 0; t < num_threads; t++) {
+      const CeedInt j = i + t * CEED_FIELD_MAX;
+
+      if (e_size > 0) {
+        CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[j]));
+        CeedCallBackend(CeedVectorSetValue(e_vecs[j], 0.0));
+      }
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &q_vecs[j]));
+      if (eval_mode == CEED_EVAL_WEIGHT) {
+        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_vecs[j]));
+      }
+    }
+    CeedCallBackend(CeedBasisDestroy(&basis));
   }
   // Drop duplicate restrictions
   if (is_input) {
@@ -157,7 +171,9 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+          for (CeedInt t = 0; t < num_threads; t++) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i + t * CEED_FIELD_MAX], &e_vecs[j + t * CEED_FIELD_MAX]));
+          }
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j] = true;
         }
@@ -181,7 +197,9 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(CeedOperatorFieldGetVector(op_fields[j], &vec_j));
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
+          for (CeedInt t = 0; t < num_threads; t++) {
+            CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i + t * CEED_FIELD_MAX], &e_vecs[j + t * CEED_FIELD_MAX]));
+          }
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j]       = true;
           apply_add_basis[i] = true;
@@ -196,6 +214,85 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Fused Interpolation and Gradient
+//   A GRAD field that shares its E-vector and tensor basis with an INTERP field
+//   is evaluated from the INTERP field Q-vector with a collocated basis
+//   This fusion is only done by the /cpu/self/opt operators; the ref and
+//   blocked operators still apply the full basis for each field
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupInterpGrad_Opt(CeedQFunction qf, CeedOperator op, bool is_input, bool *apply_add_basis, CeedBasis *field_basis,
+                                           CeedVector *e_vecs, CeedInt *interp_field, CeedBasis *grad_basis, CeedInt start_e, CeedInt num_fields) {
+  CeedQFunctionField *qf_fields;
+  CeedOperatorField  *op_fields;
+
+  if (is_input) {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, &op_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL));
+  } else {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, NULL, NULL, &qf_fields));
+  }
+
+  for (CeedInt j = 0; j < num_fields; j++) interp_field[j + start_e] = -1;
+  for (CeedInt j = 0; j < num_fields; j++) {
+    bool         is_tensor;
+    CeedInt      P_1d, Q_1d;
+    CeedEvalMode eval_mode_j;
+    CeedBasis    basis = field_basis[j + start_e];
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[j], &eval_mode_j));
+    if (eval_mode_j != CEED_EVAL_GRAD) continue;
+    // Collocated gradient requires at least as many quadrature points as nodes
+    CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+    if (!is_tensor) continue;
+    CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+    if (Q_1d < P_1d) continue;
+
+    // Find INTERP field with same vector, restriction, and basis
+    for (CeedInt i = 0; i < num_fields && interp_field[j + start_e] == -1; i++) {
+      CeedEvalMode eval_mode_i;
+
+      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode_i));
+      if (eval_mode_i == CEED_EVAL_INTERP && field_basis[i + start_e] == basis && e_vecs[i] == e_vecs[j]) interp_field[j + start_e] = i;
+    }
+    if (interp_field[j + start_e] == -1) continue;
+
+    // Collocated basis, with identity interpolation and collocated gradient
+    {
+      Ceed              ceed;
+      CeedInt           dim, num_comp;
+      CeedScalar       *interp_1d, *grad_1d;
+      const CeedScalar *q_ref_1d, *q_weight_1d;
+
+      CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
+      CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+      CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+      CeedCallBackend(CeedBasisGetQRef(basis, &q_ref_1d));
+      CeedCallBackend(CeedBasisGetQWeights(basis, &q_weight_1d));
+      CeedCallBackend(CeedCalloc(Q_1d * Q_1d, &interp_1d));
+      CeedCallBackend(CeedMalloc(Q_1d * Q_1d, &grad_1d));
+      for (CeedInt q = 0; q < Q_1d; q++) interp_1d[q * Q_1d + q] = 1.0;
+      CeedCallBackend(CeedBasisGetCollocatedGrad(basis, grad_1d));
+      CeedCallBackend(CeedBasisCreateTensorH1(ceed, dim, num_comp, Q_1d, Q_1d, interp_1d, grad_1d, q_ref_1d, q_weight_1d, &grad_basis[j + start_e]));
+      CeedCallBackend(CeedFree(&interp_1d));
+      CeedCallBackend(CeedFree(&grad_1d));
+    }
+
+    // First basis write to a shared output E-vector moves to the next unfused field
+    if (!is_input && !apply_add_basis[j]) {
+      for (CeedInt k = j + 1; k < num_fields; k++) {
+        if (e_vecs[k] == e_vecs[j] && interp_field[k + start_e] == -1) {
+          apply_add_basis[k] = false;
+          break;
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -220,9 +317,14 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedQFunctionIsIdentity(qf, &impl->is_identity_qf));
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt block_size = ceed_impl->block_size;
+  const CeedInt block_size  = ceed_impl->block_size;
+  const CeedInt num_threads = ceed_impl->num_threads;
 
   // Allocate
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->is_active));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->basis));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->interp_field));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->grad_basis));
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->block_rstr));
   CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
 
@@ -230,21 +332,29 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->skip_rstr_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->apply_add_basis_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_in));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
-  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->e_vecs_in));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->e_vecs_out));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->q_vecs_in));
+  CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->q_vecs_out));
 
+  impl->num_threads = num_threads;
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
   // Set up infield and outfield pointer arrays
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, impl->skip_rstr_in, NULL, block_size, impl->block_rstr, impl->e_vecs_full,
-                                              impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, impl->skip_rstr_in, NULL, block_size, num_threads, impl->is_active, impl->basis,
+                                              impl->block_rstr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, block_size, impl->block_rstr,
-                                              impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, impl->skip_rstr_out, impl->apply_add_basis_out, block_size, num_threads,
+                                              impl->is_active, impl->basis, impl->block_rstr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
+                                              num_input_fields, num_output_fields, Q));
+
+  // Fused interpolation and gradient
+  CeedCallBackend(CeedOperatorSetupInterpGrad_Opt(qf, op, true, NULL, impl->basis, impl->e_vecs_in, impl->interp_field, impl->grad_basis, 0,
+                                                  num_input_fields));
+  CeedCallBackend(CeedOperatorSetupInterpGrad_Opt(qf, op, false, impl->apply_add_basis_out, impl->basis, impl->e_vecs_out, impl->interp_field,
+                                                  impl->grad_basis, num_input_fields, num_output_fields));
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -258,7 +368,35 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
     if (in_mode == CEED_EVAL_NONE && out_mode == CEED_EVAL_NONE) {
       impl->is_identity_rstr_op = true;
     } else {
-      CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[0], &impl->q_vecs_out[0]));
+      for (CeedInt t = 0; t < num_threads; t++) {
+        CeedCallBackend(CeedVectorReferenceCopy(impl->q_vecs_in[t * CEED_FIELD_MAX], &impl->q_vecs_out[t * CEED_FIELD_MAX]));
+      }
+    }
+  }
+
+  // Per-thread views of active input and output L-vectors
+  if (num_threads > 1) {
+    Ceed ceed_parent;
+
+    CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+    CeedCallBackend(CeedCalloc(num_threads, &impl->l_vecs_in));
+    CeedCallBackend(CeedCalloc(num_threads * CEED_FIELD_MAX, &impl->l_vecs_out));
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedSize l_size;
+
+      if (!impl->is_active[i] || !impl->block_rstr[i]) continue;
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(impl->block_rstr[i], &l_size));
+      for (CeedInt t = 0; t < num_threads; t++) CeedCallBackend(CeedVectorCreate(ceed_parent, l_size, &impl->l_vecs_in[t]));
+      break;
+    }
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedSize l_size;
+
+      if (impl->skip_rstr_out[i]) continue;
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(impl->block_rstr[i + num_input_fields], &l_size));
+      for (CeedInt t = 0; t < num_threads; t++) {
+        CeedCallBackend(CeedVectorCreate(ceed_parent, l_size, &impl->l_vecs_out[i + t * CEED_FIELD_MAX]));
+      }
     }
   }
 
@@ -295,9 +433,13 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
       } else {
         // Set Qvec for CEED_EVAL_NONE
         if (eval_mode == CEED_EVAL_NONE) {
-          CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[i], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[i], (const CeedScalar **)&e_data[i]));
+          for (CeedInt t = 0; t < impl->num_threads; t++) {
+            const CeedInt j = i + t * CEED_FIELD_MAX;
+
+            CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[j], CEED_MEM_HOST, (const CeedScalar **)&e_data[i]));
+            CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[j], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i]));
+            CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[j], (const CeedScalar **)&e_data[i]));
+          }
         }
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -309,70 +451,75 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
 //------------------------------------------------------------------------------
 // Input Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, CeedInt block_size, CeedVector in_vec, bool skip_active,
-                                             CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedInt num_input_fields, CeedInt block_size,
+                                             CeedVector in_vec, bool skip_active, CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedVector *e_vecs_in,
+                                             CeedVector *q_vecs_in, CeedOperator_Opt *impl, CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    bool                is_active;
-    CeedInt             elem_size, size, num_comp;
-    CeedEvalMode        eval_mode;
-    CeedVector          vec;
-    CeedElemRestriction elem_rstr;
-    CeedBasis           basis;
+    const bool   is_active = impl->is_active[i];
+    CeedInt      elem_size, size, num_comp;
+    CeedEvalMode eval_mode;
 
     // Skip active input
-    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    CeedCallBackend(CeedVectorDestroy(&vec));
     if (skip_active && is_active) continue;
+    // Skip GRAD fused with INTERP
+    if (impl->interp_field[i] != -1) continue;
 
-    // Get elem_size, eval_mode, size
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    // Get eval_mode, size
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
     // Restrict block active input
     if (is_active && impl->block_rstr[i]) {
-      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
+      CeedCallBackend(CeedElemRestrictionApplyBlock(impl->block_rstr[i], e / block_size, CEED_NOTRANSPOSE, in_vec, e_vecs_in[i], request));
     }
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
         if (!is_active) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * Q * size]));
+          CeedCallBackend(CeedVectorSetArray(q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * Q * size]));
         }
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         if (!is_active) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * elem_size * num_comp]));
+          CeedCallBackend(CeedElemRestrictionGetElementSize(impl->block_rstr[i], &elem_size));
+          CeedCallBackend(CeedBasisGetNumComponents(impl->basis[i], &num_comp));
+          CeedCallBackend(CeedVectorSetArray(e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][(CeedSize)e * elem_size * num_comp]));
         }
-        CeedCallBackend(CeedBasisApply(basis, block_size, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
-        CeedCallBackend(CeedBasisDestroy(&basis));
+        CeedCallBackend(CeedBasisApply(impl->basis[i], block_size, CEED_NOTRANSPOSE, eval_mode, e_vecs_in[i], q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
         break;  // No action
     }
   }
+  // Gradient from interpolated values
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    if (impl->interp_field[i] == -1 || (skip_active && impl->is_active[i])) continue;
+    CeedCallBackend(CeedBasisApply(impl->grad_basis[i], block_size, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, q_vecs_in[impl->interp_field[i]],
+                                   q_vecs_in[i]));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt block_size, CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis,
-                                              bool *skip_rstr, CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedInt block_size,
+                                              CeedInt num_input_fields, CeedInt num_output_fields, bool *apply_add_basis, bool *skip_rstr,
+                                              CeedOperator op, CeedVector *out_vecs, CeedVector *e_vecs_out, CeedVector *q_vecs_out,
+                                              CeedOperator_Opt *impl, CeedRequest *request) {
+  // Gradient transpose into interpolated values
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    const CeedInt interp_field = impl->interp_field[i + num_input_fields];
+
+    if (interp_field == -1) continue;
+    CeedCallBackend(CeedBasisApplyAdd(impl->grad_basis[i + num_input_fields], block_size, CEED_TRANSPOSE, CEED_EVAL_GRAD, q_vecs_out[i],
+                                      q_vecs_out[interp_field]));
+  }
   for (CeedInt i = 0; i < num_output_fields; i++) {
-    bool         is_active;
     CeedEvalMode eval_mode;
-    CeedVector   vec;
-    CeedBasis    basis;
+    CeedBasis    basis = impl->basis[i + num_input_fields];
 
     // Get eval_mode
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
@@ -384,13 +531,13 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
-        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
-        if (apply_add_basis[i]) {
-          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+        if (impl->interp_field[i + num_input_fields] != -1) {
+          break;  // GRAD fused with INTERP
+        } else if (apply_add_basis[i]) {
+          CeedCallBackend(CeedBasisApplyAdd(basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
         } else {
-          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
+          CeedCallBackend(CeedBasisApply(basis, block_size, CEED_TRANSPOSE, eval_mode, q_vecs_out[i], e_vecs_out[i]));
         }
-        CeedCallBackend(CeedBasisDestroy(&basis));
         break;
       // LCOV_EXCL_START
       case CEED_EVAL_WEIGHT: {
@@ -400,14 +547,8 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
     }
     // Restrict output block
     if (skip_rstr[i]) continue;
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
-    is_active = vec == CEED_VECTOR_ACTIVE;
-    if (is_active) vec = out_vec;
-    // Restrict
     CeedCallBackend(
-        CeedElemRestrictionApplyBlock(impl->block_rstr[i + impl->num_inputs], e / block_size, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
-    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+        CeedElemRestrictionApplyBlock(impl->block_rstr[i + num_input_fields], e / block_size, CEED_TRANSPOSE, e_vecs_out[i], out_vecs[i], request));
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -431,15 +572,71 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQF
   return CEED_ERROR_SUCCESS;
 }
 
+#ifdef _OPENMP
+//------------------------------------------------------------------------------
+// Operator Apply for a Range of Element Blocks on a Single Thread
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddBlocks_Opt(CeedInt t, CeedInt block_start, CeedInt block_stop, CeedInt Q, CeedInt block_size,
+                                          CeedQFunctionField *qf_input_fields, CeedQFunctionField *qf_output_fields, CeedInt num_input_fields,
+                                          CeedInt num_output_fields, CeedQFunctionUser f, void *ctx_data, const CeedScalar *in_array,
+                                          CeedScalar *out_arrays[CEED_FIELD_MAX], CeedScalar *e_data[2 * CEED_FIELD_MAX], CeedOperator op,
+                                          CeedOperator_Opt *impl, CeedRequest *request) {
+  CeedVector  in_vec     = impl->l_vecs_in[t];
+  CeedVector *l_vecs_out = &impl->l_vecs_out[t * CEED_FIELD_MAX];
+  CeedVector *e_vecs_in  = &impl->e_vecs_in[t * CEED_FIELD_MAX], *e_vecs_out = &impl->e_vecs_out[t * CEED_FIELD_MAX];
+  CeedVector *q_vecs_in  = &impl->q_vecs_in[t * CEED_FIELD_MAX], *q_vecs_out = &impl->q_vecs_out[t * CEED_FIELD_MAX];
+
+  // Point thread L-vectors at shared arrays
+  if (in_vec) CeedCallBackend(CeedVectorSetArray(in_vec, CEED_MEM_HOST, CEED_USE_POINTER, (CeedScalar *)in_array));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    if (l_vecs_out[i]) CeedCallBackend(CeedVectorSetArray(l_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, out_arrays[i]));
+  }
+
+  // Loop through element blocks
+  for (CeedInt b = block_start; b < block_stop; b++) {
+    const CeedInt e = b * block_size;
+
+    // Input basis apply
+    CeedCallBackend(CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, num_input_fields, block_size, in_vec, false, e_data, e_vecs_in, q_vecs_in,
+                                               impl, request));
+
+    // Q function, called directly as the QFunction backend data is shared between threads
+    if (!impl->is_identity_qf) {
+      const CeedScalar *q_data_in[CEED_FIELD_MAX];
+      CeedScalar       *q_data_out[CEED_FIELD_MAX];
+
+      for (CeedInt i = 0; i < num_input_fields; i++) CeedCallBackend(CeedVectorGetArrayRead(q_vecs_in[i], CEED_MEM_HOST, &q_data_in[i]));
+      for (CeedInt i = 0; i < num_output_fields; i++) CeedCallBackend(CeedVectorGetArrayWrite(q_vecs_out[i], CEED_MEM_HOST, &q_data_out[i]));
+      CeedCallBackend(f(ctx_data, Q * block_size, q_data_in, q_data_out));
+      for (CeedInt i = 0; i < num_input_fields; i++) CeedCallBackend(CeedVectorRestoreArrayRead(q_vecs_in[i], &q_data_in[i]));
+      for (CeedInt i = 0; i < num_output_fields; i++) CeedCallBackend(CeedVectorRestoreArray(q_vecs_out[i], &q_data_out[i]));
+    }
+
+    // Output basis apply and restriction
+    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, block_size, num_input_fields, num_output_fields, impl->apply_add_basis_out,
+                                                impl->skip_rstr_out, op, l_vecs_out, e_vecs_out, q_vecs_out, impl, request));
+  }
+
+  // Release shared arrays
+  if (in_vec) CeedCallBackend(CeedVectorTakeArray(in_vec, CEED_MEM_HOST, NULL));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    if (l_vecs_out[i]) CeedCallBackend(CeedVectorTakeArray(l_vecs_out[i], CEED_MEM_HOST, NULL));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+#endif
+
 //------------------------------------------------------------------------------
 // Operator Apply
 //------------------------------------------------------------------------------
 static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                use_threads = false;
   Ceed                ceed;
   Ceed_Opt           *ceed_impl;
   CeedInt             Q, num_input_fields, num_output_fields, num_elem;
   CeedEvalMode        eval_mode;
   CeedScalar         *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedVector          out_vecs[CEED_FIELD_MAX]    = {0};
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
   CeedOperatorField  *op_input_fields, *op_output_fields;
@@ -476,27 +673,113 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
     // Set Qvec if needed
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
     if (eval_mode == CEED_EVAL_NONE) {
-      // Set qvec to single block evec
-      CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data[i + num_input_fields]));
-      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
-      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[i], &e_data[i + num_input_fields]));
+      for (CeedInt t = 0; t < impl->num_threads; t++) {
+        const CeedInt j = i + t * CEED_FIELD_MAX;
+
+        // Set qvec to single block evec
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[j], CEED_MEM_HOST, &e_data[i + num_input_fields]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[j], CEED_MEM_HOST, CEED_USE_POINTER, e_data[i + num_input_fields]));
+        CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[j], &e_data[i + num_input_fields]));
+      }
+    }
+    // Get output vector
+    if (impl->skip_rstr_out[i]) continue;
+    if (impl->is_active[i + num_input_fields]) {
+      out_vecs[i] = out_vec;
+    } else {
+      CeedVector vec;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+      out_vecs[i] = vec;
+      CeedCallBackend(CeedVectorDestroy(&vec));
     }
   }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
-    // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, in_vec, false, e_data, impl, request));
+#ifdef _OPENMP
+  // Element blocks are split between threads unless already in a parallel region
+  use_threads = impl->num_threads > 1 && num_blocks > 1 && !omp_in_parallel();
+  if (use_threads) {
+    bool                 is_writable;
+    CeedQFunctionContext ctx;
+
+    // Writable contexts may be modified by the user QFunction
+    CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+    CeedCallBackend(CeedQFunctionIsContextWritable(qf, &is_writable));
+    if (ctx && is_writable) use_threads = false;
+    // The active input must not also be written to
+    for (CeedInt i = 0; i < num_output_fields; i++) use_threads = use_threads && out_vecs[i] != in_vec;
+  }
+#endif
+
+  if (use_threads) {
+#ifdef _OPENMP
+    int               ierr        = CEED_ERROR_SUCCESS;
+    void             *ctx_data    = NULL;
+    CeedInt           event;
+    const CeedInt     num_threads = CeedIntMin(impl->num_threads, num_blocks);
+    const CeedScalar *in_array    = NULL;
+    CeedScalar       *out_arrays[CEED_FIELD_MAX] = {0};
+    CeedQFunctionUser f;
+
+    CeedCallBackend(CeedQFunctionSetImmutable(qf));
+    CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+    CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+
+    // Get L-vector arrays, shared by all threads
+    if (impl->l_vecs_in[0]) CeedCallBackend(CeedVectorGetArrayRead(in_vec, CEED_MEM_HOST, &in_array));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      if (!out_vecs[i]) continue;
+      for (CeedInt j = 0; j < i; j++) {
+        if (out_vecs[j] == out_vecs[i]) out_arrays[i] = out_arrays[j];
+      }
+      if (!out_arrays[i]) CeedCallBackend(CeedVectorGetArray(out_vecs[i], CEED_MEM_HOST, &out_arrays[i]));
+    }
 
-    // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+    // Loop through element blocks, contiguous ranges per thread
+    //   Profiling events inside the parallel region are recorded per thread and merged afterwards
+    CeedCallBackend(CeedProfileEventBegin(ceed, "CeedOperatorApply (threaded elements)", NULL, 0, &event));
+    CeedCallBackend(CeedProfileThreadsBegin(ceed, num_threads));
+    CeedPragmaOMP(parallel num_threads(num_threads)) {
+      const CeedInt num_team = omp_get_num_threads(), t = omp_get_thread_num();
+      const CeedInt block_start = ((CeedSize)num_blocks * t) / num_team, block_stop = ((CeedSize)num_blocks * (t + 1)) / num_team;
+      const int     ierr_t = CeedOperatorApplyAddBlocks_Opt(t, block_start, block_stop, Q, block_size, qf_input_fields, qf_output_fields,
+                                                            num_input_fields, num_output_fields, f, ctx_data, in_array, out_arrays, e_data, op, impl,
+                                                            request);
+
+      if (ierr_t != CEED_ERROR_SUCCESS) {
+        CeedPragmaCritical(CeedOperatorApplyAdd_Opt) ierr = ierr_t;
+      }
     }
+    CeedCallBackend(CeedProfileThreadsEnd(ceed));
+    CeedCallBackend(CeedProfileEventEnd(ceed, event, NULL));
 
-    // Output basis apply and restriction
-    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, op_output_fields, block_size, num_input_fields, num_output_fields,
-                                                impl->apply_add_basis_out, impl->skip_rstr_out, op, out_vec, impl, request));
+    // Restore L-vector arrays
+    if (in_array) CeedCallBackend(CeedVectorRestoreArrayRead(in_vec, &in_array));
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      bool is_restored = !out_vecs[i];
+
+      for (CeedInt j = 0; j < i; j++) is_restored = is_restored || out_vecs[j] == out_vecs[i];
+      if (!is_restored) CeedCallBackend(CeedVectorRestoreArray(out_vecs[i], &out_arrays[i]));
+    }
+    CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+    CeedCallBackend(ierr);
+#endif
+  } else {
+    // Loop through elements
+    for (CeedInt e = 0; e < num_blocks * block_size; e += block_size) {
+      // Input basis apply
+      CeedCallBackend(CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, num_input_fields, block_size, in_vec, false, e_data, impl->e_vecs_in,
+                                                 impl->q_vecs_in, impl, request));
+
+      // Q function
+      if (!impl->is_identity_qf) {
+        CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      }
+
+      // Output basis apply and restriction
+      CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, block_size, num_input_fields, num_output_fields, impl->apply_add_basis_out,
+                                                  impl->skip_rstr_out, op, out_vecs, impl->e_vecs_out, impl->q_vecs_out, impl, request));
+    }
   }
 
   // Restore input arrays
@@ -505,43 +788,16 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
 }
 
 //------------------------------------------------------------------------------
-// Core code for linear QFunction assembly
+// Count Active Fields for Linear QFunction Assembly
 //------------------------------------------------------------------------------
-static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
-                                                              CeedRequest *request) {
-  Ceed                ceed;
-  Ceed_Opt           *ceed_impl;
-  CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
-  CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Opt   *impl;
+static inline int CeedOperatorLinearAssembleQFunctionSizes_Opt(CeedOperator op, CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+                                                               CeedOperatorField *op_input_fields, CeedInt num_output_fields,
+                                                               CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+                                                               CeedOperator_Opt *impl) {
+  Ceed    ceed;
+  CeedInt qf_size_in = impl->qf_size_in, qf_size_out = impl->qf_size_out;
 
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
-  CeedCallBackend(CeedOperatorGetData(op, &impl));
-  qf_size_in  = impl->qf_size_in;
-  qf_size_out = impl->qf_size_out;
-
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  const CeedInt       block_size = ceed_impl->block_size;
-  const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
-  CeedVector          l_vec      = impl->qf_l_vec;
-  CeedElemRestriction block_rstr = impl->qf_block_rstr;
-
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Opt(op));
-
-  // Check for restriction only operator
-  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
-
-  // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, NULL, e_data, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -553,7 +809,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
       CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
         qf_size_in += field_size;
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -562,6 +817,15 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     impl->qf_size_in = qf_size_in;
   }
 
+  // Clear active input Qvecs, which hold basis output after operator application
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
   // Count number of active output fields
   if (qf_size_out == 0) {
     for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -579,6 +843,135 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     CeedCheck(qf_size_out > 0, ceed, CEED_ERROR_BACKEND, "Cannot assemble QFunction without active inputs and outputs");
     impl->qf_size_out = qf_size_out;
   }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Single Element Block
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionElementBlock_Opt(CeedInt Q, CeedInt block_size, CeedQFunction qf,
+                                                                      CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                                      CeedInt num_input_fields, CeedQFunctionField *qf_output_fields,
+                                                                      CeedOperatorField *op_output_fields, CeedInt num_output_fields,
+                                                                      CeedOperator_Opt *impl, CeedScalar *assembled_array) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool       is_active;
+    CeedInt    field_size;
+    CeedVector vec;
+
+    // Check if active input
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    if (!is_active) continue;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
+    for (CeedInt field = 0; field < field_size; field++) {
+      // Set current portion of input to 1.0
+      {
+        CeedScalar *array;
+
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 1.0;
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+      }
+
+      if (!impl->is_identity_qf) {
+        // Set Outputs
+        for (CeedInt out = 0; out < num_output_fields; out++) {
+          CeedVector vec;
+
+          // Check if active output
+          CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+          if (vec == CEED_VECTOR_ACTIVE) {
+            CeedInt field_size;
+
+            CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, assembled_array));
+            CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
+            assembled_array += field_size * Q * block_size;  // Advance the pointer by the size of the output
+          }
+          CeedCallBackend(CeedVectorDestroy(&vec));
+        }
+        // Apply QFunction
+        CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
+      } else {
+        CeedInt           field_size;
+        const CeedScalar *array;
+
+        // Copy Identity Outputs
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
+        CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < field_size * Q * block_size; j++) assembled_array[j] = array[j];
+        CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
+        assembled_array += field_size * Q * block_size;
+      }
+      // Reset input to 0.0
+      {
+        CeedScalar *array;
+
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 0.0;
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+      }
+    }
+  }
+
+  // Un-set output Qvecs to prevent accidental overwrite of Assembled
+  if (!impl->is_identity_qf) {
+    for (CeedInt out = 0; out < num_output_fields; out++) {
+      CeedVector vec;
+
+      // Check if active output
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
+      }
+      CeedCallBackend(CeedVectorDestroy(&vec));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for linear QFunction assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
+                                                              CeedRequest *request) {
+  Ceed                ceed;
+  Ceed_Opt           *ceed_impl;
+  CeedInt             qf_size_in, qf_size_out, Q, num_input_fields, num_output_fields, num_elem;
+  CeedScalar         *l_vec_array, *e_data[2 * CEED_FIELD_MAX] = {0};
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Opt   *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  const CeedInt       block_size = ceed_impl->block_size;
+  const CeedInt       num_blocks = (num_elem / block_size) + !!(num_elem % block_size);
+  CeedVector          l_vec      = impl->qf_l_vec;
+  CeedElemRestriction block_rstr = impl->qf_block_rstr;
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, NULL, e_data, impl, request));
+
+  // Count number of active input and output fields
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSizes_Opt(op, num_input_fields, qf_input_fields, op_input_fields, num_output_fields,
+                                                               qf_output_fields, op_output_fields, impl));
+  qf_size_in  = impl->qf_size_in;
+  qf_size_out = impl->qf_size_out;
 
   // Setup l_vec
   if (!l_vec) {
@@ -616,84 +1009,12 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     CeedCallBackend(CeedVectorGetArray(l_vec, CEED_MEM_HOST, &l_vec_array));
 
     // Input basis apply
-    CeedCallBackend(
-        CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, block_size, NULL, true, e_data, impl, request));
+    CeedCallBackend(CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, num_input_fields, block_size, NULL, true, e_data, impl->e_vecs_in,
+                                               impl->q_vecs_in, impl, request));
 
     // Assemble QFunction
-    for (CeedInt i = 0; i < num_input_fields; i++) {
-      bool       is_active;
-      CeedInt    field_size;
-      CeedVector vec;
-
-      // Check if active input
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (!is_active) continue;
-      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-      for (CeedInt field = 0; field < field_size; field++) {
-        // Set current portion of input to 1.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 1.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-
-        if (!impl->is_identity_qf) {
-          // Set Outputs
-          for (CeedInt out = 0; out < num_output_fields; out++) {
-            CeedVector vec;
-
-            // Check if active output
-            CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-            if (vec == CEED_VECTOR_ACTIVE) {
-              CeedInt field_size;
-
-              CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, l_vec_array));
-              CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
-              l_vec_array += field_size * Q * block_size;  // Advance the pointer by the size of the output
-            }
-            CeedCallBackend(CeedVectorDestroy(&vec));
-          }
-          // Apply QFunction
-          CeedCallBackend(CeedQFunctionApply(qf, Q * block_size, impl->q_vecs_in, impl->q_vecs_out));
-        } else {
-          CeedInt           field_size;
-          const CeedScalar *array;
-
-          // Copy Identity Outputs
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
-          CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < field_size * Q * block_size; j++) l_vec_array[j] = array[j];
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
-          l_vec_array += field_size * Q * block_size;
-        }
-        // Reset input to 0.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q * block_size; j++) array[field * Q * block_size + j] = 0.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-      }
-    }
-
-    // Un-set output Qvecs to prevent accidental overwrite of Assembled
-    if (!impl->is_identity_qf) {
-      for (CeedInt out = 0; out < num_output_fields; out++) {
-        CeedVector vec;
-
-        // Check if active output
-        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-        if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
-          CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
-        }
-        CeedCallBackend(CeedVectorDestroy(&vec));
-      }
-    }
+    CeedCallBackend(CeedOperatorLinearAssembleQFunctionElementBlock_Opt(Q, block_size, qf, qf_input_fields, op_input_fields, num_input_fields,
+                                                                        qf_output_fields, op_output_fields, num_output_fields, impl, l_vec_array));
 
     // Assemble into assembled vector
     CeedCallBackend(CeedVectorRestoreArray(l_vec, &l_vec_array));
@@ -729,6 +1050,114 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVe
   return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, &assembled, &rstr, request);
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Block of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionBlock_Opt(CeedOperator op, CeedInt e_start, CeedInt num_elem_block, void *ctx,
+                                                        CeedScalar *assembled_block, CeedRequest *request) {
+  CeedInt                   block_size, Q, num_input_fields, num_output_fields;
+  Ceed_Opt                 *ceed_impl;
+  CeedQFunctionField       *qf_input_fields, *qf_output_fields;
+  CeedQFunction             qf;
+  CeedOperatorField        *op_input_fields, *op_output_fields;
+  CeedOperator_Opt         *impl;
+  CeedOperatorDiagonal_Opt *data = ctx;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedGetData(CeedOperatorReturnCeed(op), &ceed_impl));
+  block_size = ceed_impl->block_size;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Input Evecs and Restriction
+  if (!data->is_setup) {
+    CeedCallBackend(CeedOperatorSetupInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, NULL, data->e_data, impl, request));
+    data->is_setup = true;
+  }
+
+  // Input basis apply
+  CeedCallBackend(CeedOperatorInputBasis_Opt(e_start, Q, qf_input_fields, num_input_fields, block_size, NULL, true, data->e_data, impl->e_vecs_in,
+                                              impl->q_vecs_in, impl, request));
+
+  // Assemble QFunction
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionElementBlock_Opt(Q, block_size, qf, qf_input_fields, op_input_fields, num_input_fields,
+                                                                      qf_output_fields, op_output_fields, num_output_fields, impl, assembled_block));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for assembling operator diagonal or point block diagonal
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleAddDiagonalCore_Opt(CeedOperator op, bool is_point_block, CeedVector assembled,
+                                                                CeedRequest *request) {
+  Ceed                     ceed;
+  CeedInt                  block_size, Q, num_input_fields, num_output_fields;
+  Ceed_Opt                *ceed_impl;
+  CeedQFunctionField      *qf_input_fields, *qf_output_fields;
+  CeedQFunction            qf;
+  CeedOperatorField       *op_input_fields, *op_output_fields;
+  CeedOperator_Opt        *impl;
+  CeedOperatorDiagonal_Opt data = {false, {NULL}};
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  block_size = ceed_impl->block_size;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Count number of active input and output fields
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSizes_Opt(op, num_input_fields, qf_input_fields, op_input_fields, num_output_fields,
+                                                               qf_output_fields, op_output_fields, impl));
+
+  // Assemble diagonal one element block at a time
+  {
+    const CeedInt layout_block[3] = {block_size, Q * block_size, 1};
+
+    CeedCallBackend(CeedOperatorLinearAssembleAddDiagonalByBlock(op, block_size, layout_block, CeedOperatorLinearAssembleQFunctionBlock_Opt, &data,
+                                                                 is_point_block, assembled, request));
+  }
+  if (!data.is_setup) return CEED_ERROR_SUCCESS;
+
+  // Reset output Qvecs
+  for (CeedInt out = 0; out < num_output_fields; out++) {
+    CeedVector vec;
+
+    // Initialize array if active output
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_out[out], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
+  // Restore input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, data.e_data, impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddDiagonal_Opt(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Opt(op, false, assembled, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Point Block Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Opt(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Opt(op, true, assembled, request);
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -737,9 +1166,15 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
 
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    CeedCallBackend(CeedBasisDestroy(&impl->basis[i]));
+    CeedCallBackend(CeedBasisDestroy(&impl->grad_basis[i]));
     CeedCallBackend(CeedElemRestrictionDestroy(&impl->block_rstr[i]));
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
   }
+  CeedCallBackend(CeedFree(&impl->is_active));
+  CeedCallBackend(CeedFree(&impl->basis));
+  CeedCallBackend(CeedFree(&impl->interp_field));
+  CeedCallBackend(CeedFree(&impl->grad_basis));
   CeedCallBackend(CeedFree(&impl->block_rstr));
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
   CeedCallBackend(CeedFree(&impl->input_states));
@@ -747,20 +1182,31 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   CeedCallBackend(CeedFree(&impl->skip_rstr_out));
   CeedCallBackend(CeedFree(&impl->apply_add_basis_out));
 
-  for (CeedInt i = 0; i < impl->num_inputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i]));
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i + t * CEED_FIELD_MAX]));
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_in[i + t * CEED_FIELD_MAX]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i + t * CEED_FIELD_MAX]));
+      CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i + t * CEED_FIELD_MAX]));
+    }
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_in));
   CeedCallBackend(CeedFree(&impl->q_vecs_in));
-
-  for (CeedInt i = 0; i < impl->num_outputs; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_out[i]));
-    CeedCallBackend(CeedVectorDestroy(&impl->q_vecs_out[i]));
-  }
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
 
+  // Thread L-vector views
+  if (impl->l_vecs_in) {
+    for (CeedInt t = 0; t < impl->num_threads; t++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->l_vecs_in[t]));
+      for (CeedInt i = 0; i < impl->num_outputs; i++) CeedCallBackend(CeedVectorDestroy(&impl->l_vecs_out[i + t * CEED_FIELD_MAX]));
+    }
+  }
+  CeedCallBackend(CeedFree(&impl->l_vecs_in));
+  CeedCallBackend(CeedFree(&impl->l_vecs_out));
+
   // QFunction assembly data
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
   CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_block_rstr));
@@ -788,7 +1234,12 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
 
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonal_Opt));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddPointBlockDiagonal", CeedOperatorLinearAssembleAddPointBlockDiagonal_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddElementMatrices", CeedOperatorApplyAddElementMatrices_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddFDMElementInverse", CeedOperatorApplyAddFDMElementInverse_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
   return CEED_ERROR_SUCCESS;
 }
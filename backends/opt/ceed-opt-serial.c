@@ -9,6 +9,9 @@
 #include <ceed/backend.h>
 #include <stdbool.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "ceed-opt.h"
 
@@ -32,7 +35,6 @@ static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
 
   CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/opt/serial"), ceed, CEED_ERROR_BACKEND,
             "Opt backend cannot use resource: %s", resource);
-  CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
   CeedCallBackend(CeedInit("/cpu/self/ref/serial", &ceed_ref));
@@ -42,10 +44,18 @@ static int CeedInit_Opt_Serial(const char *resource, Ceed ceed) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Opt));
 
-  // Set block size
+  // Set block size and number of threads
   CeedCallBackend(CeedCalloc(1, &data));
   data->block_size = 1;
+#ifdef _OPENMP
+  data->num_threads = omp_get_max_threads();
+#else
+  data->num_threads = 1;
+#endif
   CeedCallBackend(CeedSetData(ceed, data));
+
+  // Threaded transpose restriction accumulates in arbitrary order
+  CeedCallBackend(CeedSetDeterministic(ceed, data->num_threads == 1));
   return CEED_ERROR_SUCCESS;
 }
 
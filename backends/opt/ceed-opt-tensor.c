@@ -34,6 +34,100 @@ static inline int CeedTensorContractApply_Core_Opt(CeedTensorContract contract,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Fixed Size loop
+//   B and J are compile-time constants in each instantiation below, so the j
+//   loops unroll and each output column stays in J registers
+//------------------------------------------------------------------------------
+static inline int CeedTensorContractApply_Fixed_Opt(CeedInt A, const CeedInt B, CeedInt C, const CeedInt J, const CeedScalar *restrict t,
+                                                    CeedTransposeMode t_mode, const CeedScalar *restrict u, CeedScalar *restrict v) {
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J;
+  }
+
+  CeedScalar tt[J][B];  // Local copy of t, indexed as in CEED_NOTRANSPOSE
+
+  for (CeedInt j = 0; j < J; j++) {
+    for (CeedInt b = 0; b < B; b++) tt[j][b] = t[j * t_stride_0 + b * t_stride_1];
+  }
+  for (CeedInt a = 0; a < A; a++) {
+    for (CeedInt c = 0; c < C; c++) {
+      CeedScalar vv[J];  // Output column to be held in registers
+
+      CeedPragmaUnroll for (CeedInt j = 0; j < J; j++) vv[j] = v[(a * J + j) * C + c];
+      for (CeedInt b = 0; b < B; b++) {
+        const CeedScalar uu = u[(a * B + b) * C + c];
+
+        CeedPragmaUnroll for (CeedInt j = 0; j < J; j++) vv[j] += tt[j][b] * uu;
+      }
+      CeedPragmaUnroll for (CeedInt j = 0; j < J; j++) v[(a * J + j) * C + c] = vv[j];
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract - Common Sizes
+//------------------------------------------------------------------------------
+typedef int (*CeedTensorContractFixed_Opt)(CeedInt, CeedInt, const CeedScalar *restrict, CeedTransposeMode, const CeedScalar *restrict,
+                                           CeedScalar *restrict);
+
+#define CEED_TENSOR_CONTRACT_FIXED_OPT(B, J)                                                                                                      \
+  static int CeedTensorContractApply_Opt_##B##_##J(CeedInt A, CeedInt C, const CeedScalar *restrict t, CeedTransposeMode t_mode,                \
+                                                   const CeedScalar *restrict u, CeedScalar *restrict v) {                                     \
+    return CeedTensorContractApply_Fixed_Opt(A, B, C, J, t, t_mode, u, v);                                                                      \
+  }
+#define CEED_TENSOR_CONTRACT_FIXED_OPT_B(B)                                                                                                       \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 2)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 3)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 4)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 5)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 6)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 7)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 8)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 9)                                                                                                            \
+  CEED_TENSOR_CONTRACT_FIXED_OPT(B, 10)
+#define CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(B)                                                                                                     \
+  {NULL,                                                                                                                                          \
+   NULL,                                                                                                                                          \
+   CeedTensorContractApply_Opt_##B##_2,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_3,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_4,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_5,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_6,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_7,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_8,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_9,                                                                                                           \
+   CeedTensorContractApply_Opt_##B##_10}
+
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(2)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(3)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(4)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(5)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(6)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(7)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(8)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(9)
+CEED_TENSOR_CONTRACT_FIXED_OPT_B(10)
+
+// Indexed by [B][J], NULL for sizes without a fixed size kernel
+static const CeedTensorContractFixed_Opt fixed_kernels[CEED_OPT_FIXED_MAX_1D + 1][CEED_OPT_FIXED_MAX_1D + 1] = {
+    {NULL},
+    {NULL},
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(2),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(3),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(4),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(5),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(6),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(7),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(8),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(9),
+    CEED_TENSOR_CONTRACT_FIXED_OPT_ROW(10),
+};
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -43,6 +137,12 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A, C
     for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
   }
 
+  // Fixed size kernels for common 1D sizes, when there are too few columns for the generic loop to vectorize well
+  if (C <= CEED_OPT_FIXED_MAX_C && B <= CEED_OPT_FIXED_MAX_1D && J <= CEED_OPT_FIXED_MAX_1D && fixed_kernels[B][J]) {
+    return fixed_kernels[B][J](A, C, t, t_mode, u, v);
+  }
+
+  // Generic sizes
   if (C == 1) return CeedTensorContractApply_Core_Opt(contract, A, B, 1, J, t, t_mode, add, u, v);
   else return CeedTensorContractApply_Core_Opt(contract, A, B, C, J, t, t_mode, add, u, v);
   return CEED_ERROR_SUCCESS;
@@ -11,8 +11,23 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Largest 1D size with fixed size tensor contraction kernels
+#define CEED_OPT_FIXED_MAX_1D 10
+// Largest number of columns for the fixed size tensor contraction kernels
+#define CEED_OPT_FIXED_MAX_C 7
+
+// Full unrolling of loops over fixed sizes, independent of the optimization level
+#if defined(__INTEL_COMPILER)
+#define CeedPragmaUnroll _Pragma("unroll")
+#elif defined(__GNUC__) || defined(__clang__)
+#define CeedPragmaUnroll _Pragma("GCC unroll 16")
+#else
+#define CeedPragmaUnroll
+#endif
+
 typedef struct {
   CeedInt block_size;
+  CeedInt num_threads;
 } Ceed_Opt;
 
 typedef struct {
@@ -22,19 +37,31 @@ typedef struct {
 typedef struct {
   bool                 is_identity_qf, is_identity_rstr_op;
   bool                *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
+  bool                *is_active;    /* Active fields, inputs followed by outputs */
+  CeedBasis           *basis;        /* Field bases, inputs followed by outputs */
+  CeedInt             *interp_field; /* INTERP field fused with each GRAD field, -1 if none, inputs followed by outputs */
+  CeedBasis           *grad_basis;   /* Collocated gradient bases for fused GRAD fields, inputs followed by outputs */
   CeedElemRestriction *block_rstr;   /* Blocked versions of restrictions */
   CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
   uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
+  CeedVector          *e_vecs_in;    /* Element block input E-vectors, CEED_FIELD_MAX per thread  */
+  CeedVector          *e_vecs_out;   /* Element block output E-vectors, CEED_FIELD_MAX per thread */
+  CeedVector          *q_vecs_in;    /* Element block input Q-vectors, CEED_FIELD_MAX per thread  */
+  CeedVector          *q_vecs_out;   /* Element block output Q-vectors, CEED_FIELD_MAX per thread */
+  CeedVector          *l_vecs_in;    /* Per-thread views of the active input L-vector */
+  CeedVector          *l_vecs_out;   /* Per-thread views of output L-vectors, CEED_FIELD_MAX per thread */
+  CeedInt              num_threads;
   CeedInt              num_inputs, num_outputs;
   CeedInt              qf_size_in, qf_size_out;
   CeedVector           qf_l_vec;
   CeedElemRestriction  qf_block_rstr;
 } CeedOperator_Opt;
 
+typedef struct {
+  bool        is_setup;                   /* Input E-vectors are set up when the first element block is assembled */
+  CeedScalar *e_data[2 * CEED_FIELD_MAX]; /* Input E-vector arrays */
+} CeedOperatorDiagonal_Opt;
+
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedTensorContract contract);
 
 CEED_INTERN int CeedOperatorCreate_Opt(CeedOperator op);
@@ -10,15 +10,18 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "ceed-ref.h"
 
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
-static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool is_input, bool *skip_rstr, CeedInt *e_data_out_indices,
-                                       bool *apply_add_basis, CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e,
-                                       CeedInt num_fields, CeedInt Q) {
+static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool is_input, bool is_streaming, bool *skip_rstr,
+                                       CeedInt *e_data_out_indices, bool *apply_add_basis, CeedVector *e_vecs_full, CeedVector *e_vecs,
+                                       CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
   Ceed                ceed;
   CeedSize            e_size, q_size;
   CeedInt             num_comp, size, P;
@@ -49,7 +52,19 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
     if (eval_mode != CEED_EVAL_WEIGHT) {
       CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &elem_rstr));
-      CeedCallBackend(CeedElemRestrictionCreateVector(elem_rstr, NULL, &e_vecs_full[i + start_e]));
+      if (is_streaming) {
+        // Single element E-vector for fields without basis action, shared with the Q-vector during apply
+        if (eval_mode == CEED_EVAL_NONE) {
+          CeedInt elem_size;
+
+          CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
+          CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+          e_size = (CeedSize)elem_size * num_comp;
+          CeedCallBackend(CeedVectorCreate(ceed, e_size, &e_vecs[i]));
+        }
+      } else {
+        CeedCallBackend(CeedElemRestrictionCreateVector(elem_rstr, NULL, &e_vecs_full[i + start_e]));
+      }
       CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
     }
 
@@ -98,7 +113,7 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
+          if (!is_streaming) CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j] = true;
         }
         CeedCallBackend(CeedVectorDestroy(&vec_j));
@@ -122,7 +137,7 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[j], &rstr_j));
         if (vec_i == vec_j && rstr_i == rstr_j) {
           CeedCallBackend(CeedVectorReferenceCopy(e_vecs[i], &e_vecs[j]));
-          CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
+          if (!is_streaming) CeedCallBackend(CeedVectorReferenceCopy(e_vecs_full[i + start_e], &e_vecs_full[j + start_e]));
           skip_rstr[j]          = true;
           apply_add_basis[i]    = true;
           e_data_out_indices[j] = i;
@@ -142,6 +157,8 @@ static int CeedOperatorSetupFields_Ref(CeedQFunction qf, CeedOperator op, bool i
 //------------------------------------------------------------------------------/*
 static int CeedOperatorSetup_Ref(CeedOperator op) {
   bool                is_setup_done;
+  Ceed                ceed;
+  Ceed_Ref           *ceed_impl;
   CeedInt             Q, num_input_fields, num_output_fields;
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
   CeedQFunction       qf;
@@ -151,6 +168,8 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
   if (is_setup_done) return CEED_ERROR_SUCCESS;
 
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
@@ -171,16 +190,18 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
 
-  impl->num_inputs  = num_input_fields;
-  impl->num_outputs = num_output_fields;
+  impl->num_inputs   = num_input_fields;
+  impl->num_outputs  = num_output_fields;
+  impl->is_streaming = ceed_impl->is_streaming;
 
   // Set up infield and outfield e_vecs and q_vecs
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, true, impl->skip_rstr_in, NULL, NULL, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0,
-                                              num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, true, impl->is_streaming, impl->skip_rstr_in, NULL, NULL, impl->e_vecs_full, impl->e_vecs_in,
+                                              impl->q_vecs_in, 0, num_input_fields, Q));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, false, impl->skip_rstr_out, impl->e_data_out_indices, impl->apply_add_basis_out,
-                                              impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields, num_output_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Ref(qf, op, false, impl->is_streaming, impl->skip_rstr_out, impl->e_data_out_indices,
+                                              impl->apply_add_basis_out, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out, num_input_fields,
+                                              num_output_fields, Q));
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -225,6 +246,13 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     // Restrict and Evec
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
+    } else if (impl->is_streaming) {
+      // Set Qvec to single element Evec, restricted in the element loop
+      if (eval_mode == CEED_EVAL_NONE) {
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_in[i], CEED_MEM_HOST, &e_data_full[i]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data_full[i]));
+        CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_in[i], &e_data_full[i]));
+      }
     } else {
       // Restrict
       CeedCallBackend(CeedVectorGetState(vec, &state));
@@ -249,42 +277,51 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
 // Input Basis Action
 //------------------------------------------------------------------------------
 static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                             CeedInt num_input_fields, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                             CeedOperator_Ref *impl) {
+                                             CeedInt num_input_fields, CeedVector in_vec, const bool skip_active,
+                                             CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl, CeedRequest *request) {
   for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool                is_active;
     CeedInt             elem_size, size, num_comp;
     CeedEvalMode        eval_mode;
+    CeedVector          vec;
     CeedElemRestriction elem_rstr;
     CeedBasis           basis;
 
     // Skip active input
-    if (skip_active) {
-      bool       is_active;
-      CeedVector vec;
-
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (is_active) continue;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    if (is_active) {
+      if (skip_active) continue;
+      else vec = in_vec;
     }
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_rstr));
     CeedCallBackend(CeedElemRestrictionGetElementSize(elem_rstr, &elem_size));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    // Restrict single element
+    if (impl->is_streaming && eval_mode != CEED_EVAL_WEIGHT && !impl->skip_rstr_in[i]) {
+      CeedCallBackend(CeedElemRestrictionApplyBlock(elem_rstr, e, CEED_NOTRANSPOSE, vec, impl->e_vecs_in[i], request));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        if (!impl->is_streaming) {
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
+        }
         break;
       case CEED_EVAL_INTERP:
       case CEED_EVAL_GRAD:
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+        if (!impl->is_streaming) {
+          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+          CeedCallBackend(
+              CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+        }
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, eval_mode, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         CeedCallBackend(CeedBasisDestroy(&basis));
         break;
@@ -321,9 +358,11 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctio
       case CEED_EVAL_DIV:
       case CEED_EVAL_CURL:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
-        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
-                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
+        if (!impl->is_streaming) {
+          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                             &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
+        }
         if (apply_add_basis[i]) {
           CeedCallBackend(CeedBasisApplyAdd(basis, 1, CEED_TRANSPOSE, eval_mode, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         } else {
@@ -341,6 +380,30 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctio
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Output Restriction of a Single Element
+//------------------------------------------------------------------------------
+static inline int CeedOperatorOutputRestrictElement_Ref(CeedInt e, CeedOperatorField *op_output_fields, CeedInt num_output_fields, CeedVector out_vec,
+                                                        CeedOperator_Ref *impl, CeedRequest *request) {
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    bool                is_active;
+    CeedVector          vec;
+    CeedElemRestriction elem_rstr;
+
+    if (impl->skip_rstr_out[i]) continue;
+    // Get output vector
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    if (is_active) vec = out_vec;
+    // Restrict
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_rstr));
+    CeedCallBackend(CeedElemRestrictionApplyBlock(elem_rstr, e, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
+    if (!is_active) CeedCallBackend(CeedVectorDestroy(&vec));
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Restore Input Vectors
 //------------------------------------------------------------------------------
@@ -361,7 +424,7 @@ static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields, CeedQF
     }
     // Restore input
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
-    if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
+    if (eval_mode == CEED_EVAL_WEIGHT || impl->is_streaming) {  // Skip
     } else {
       CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
     }
@@ -393,14 +456,21 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
 
   // Restriction only operator
   if (impl->is_identity_rstr_op) {
-    CeedElemRestriction elem_rstr;
-
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
-    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_rstr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_rstr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
-    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr));
+    CeedElemRestriction elem_rstr_in, elem_rstr_out;
+
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_rstr_in));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_rstr_out));
+    if (impl->is_streaming) {
+      for (CeedInt e = 0; e < num_elem; e++) {
+        CeedCallBackend(CeedElemRestrictionApplyBlock(elem_rstr_in, e, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[0], request));
+        CeedCallBackend(CeedElemRestrictionApplyBlock(elem_rstr_out, e, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vec, request));
+      }
+    } else {
+      CeedCallBackend(CeedElemRestrictionApply(elem_rstr_in, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+      CeedCallBackend(CeedElemRestrictionApply(elem_rstr_out, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    }
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_in));
+    CeedCallBackend(CeedElemRestrictionDestroy(&elem_rstr_out));
     return CEED_ERROR_SUCCESS;
   }
 
@@ -409,7 +479,15 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
 
   // Output Evecs
   for (CeedInt i = num_output_fields - 1; i >= 0; i--) {
-    if (impl->skip_rstr_out[i]) {
+    if (impl->is_streaming) {
+      // Set Qvec to single element Evec
+      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+      if (eval_mode == CEED_EVAL_NONE) {
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data_full[i + num_input_fields]));
+        CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_out[i], &e_data_full[i + num_input_fields]));
+      }
+    } else if (impl->skip_rstr_out[i]) {
       e_data_full[i + num_input_fields] = e_data_full[impl->e_data_out_indices[i] + num_input_fields];
     } else {
       CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + impl->num_inputs], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
@@ -419,7 +497,7 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
     // Output pointers
-    for (CeedInt i = 0; i < num_output_fields; i++) {
+    for (CeedInt i = 0; i < num_output_fields && !impl->is_streaming; i++) {
       CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
       if (eval_mode == CEED_EVAL_NONE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
@@ -429,7 +507,8 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     }
 
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
+    CeedCallBackend(
+        CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, in_vec, false, e_data_full, impl, request));
 
     // Q function
     if (!impl->is_identity_qf) {
@@ -439,10 +518,13 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     // Output basis apply
     CeedCallBackend(CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields,
                                                 impl->apply_add_basis_out, op, e_data_full, impl));
+
+    // Output restriction
+    if (impl->is_streaming) CeedCallBackend(CeedOperatorOutputRestrictElement_Ref(e, op_output_fields, num_output_fields, out_vec, impl, request));
   }
 
   // Output restriction
-  for (CeedInt i = 0; i < num_output_fields; i++) {
+  for (CeedInt i = 0; i < num_output_fields && !impl->is_streaming; i++) {
     bool                is_active;
     CeedVector          vec;
     CeedElemRestriction elem_rstr;
@@ -468,37 +550,16 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
 }
 
 //------------------------------------------------------------------------------
-// Core code for assembling linear QFunction
+// Count Active Fields for Linear QFunction Assembly
 //------------------------------------------------------------------------------
-static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
-                                                              CeedRequest *request) {
-  Ceed                ceed, ceed_parent;
-  CeedInt             qf_size_in, qf_size_out, Q, num_elem, num_input_fields, num_output_fields;
-  CeedScalar         *assembled_array, *e_data_full[2 * CEED_FIELD_MAX] = {NULL};
-  CeedQFunctionField *qf_input_fields, *qf_output_fields;
-  CeedQFunction       qf;
-  CeedOperatorField  *op_input_fields, *op_output_fields;
-  CeedOperator_Ref   *impl;
+static inline int CeedOperatorLinearAssembleQFunctionSizes_Ref(CeedOperator op, CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+                                                               CeedOperatorField *op_input_fields, CeedInt num_output_fields,
+                                                               CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+                                                               CeedOperator_Ref *impl) {
+  Ceed    ceed;
+  CeedInt qf_size_in = impl->qf_size_in, qf_size_out = impl->qf_size_out;
 
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
-  CeedCallBackend(CeedOperatorGetFallbackParentCeed(op, &ceed_parent));
-  CeedCallBackend(CeedOperatorGetData(op, &impl));
-  qf_size_in  = impl->qf_size_in;
-  qf_size_out = impl->qf_size_out;
-  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
-  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
-  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
-
-  // Setup
-  CeedCallBackend(CeedOperatorSetup_Ref(op));
-
-  // Check for restriction only operator
-  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
-
-  // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
 
   // Count number of active input fields
   if (qf_size_in == 0) {
@@ -511,7 +572,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
       // Check if active input
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
         qf_size_in += field_size;
       }
       CeedCallBackend(CeedVectorDestroy(&vec));
@@ -520,6 +580,15 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
     impl->qf_size_in = qf_size_in;
   }
 
+  // Clear active input Qvecs, which hold basis output after operator application
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
+    CeedCallBackend(CeedVectorDestroy(&vec));
+  }
+
   // Count number of active output fields
   if (qf_size_out == 0) {
     for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -538,6 +607,116 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
     CeedCheck(qf_size_out > 0, ceed, CEED_ERROR_BACKEND, "Cannot assemble QFunction without active inputs and outputs");
     impl->qf_size_out = qf_size_out;
   }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Single Element
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionElement_Ref(CeedInt Q, CeedQFunction qf, CeedQFunctionField *qf_input_fields,
+                                                                 CeedOperatorField *op_input_fields, CeedInt num_input_fields,
+                                                                 CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
+                                                                 CeedInt num_output_fields, CeedOperator_Ref *impl, CeedScalar *assembled_array) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    bool       is_active;
+    CeedInt    field_size;
+    CeedVector vec;
+
+    // Set Inputs
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    is_active = vec == CEED_VECTOR_ACTIVE;
+    CeedCallBackend(CeedVectorDestroy(&vec));
+    if (!is_active) continue;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
+    for (CeedInt field = 0; field < field_size; field++) {
+      // Set current portion of input to 1.0
+      {
+        CeedScalar *array;
+
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < Q; j++) array[field * Q + j] = 1.0;
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+      }
+
+      if (!impl->is_identity_qf) {
+        // Set Outputs
+        for (CeedInt out = 0; out < num_output_fields; out++) {
+          CeedVector vec;
+
+          // Get output vector
+          CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+          // Check if active output
+          if (vec == CEED_VECTOR_ACTIVE) {
+            CeedInt field_size;
+
+            CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, assembled_array));
+            CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
+            assembled_array += field_size * Q;  // Advance the pointer by the size of the output
+          }
+          CeedCallBackend(CeedVectorDestroy(&vec));
+        }
+        // Apply QFunction
+        CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
+      } else {
+        CeedInt           field_size;
+        const CeedScalar *array;
+
+        // Copy Identity Outputs
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
+        CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < field_size * Q; j++) assembled_array[j] = array[j];
+        CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
+        assembled_array += field_size * Q;
+      }
+      // Reset input to 0.0
+      {
+        CeedScalar *array;
+
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
+        for (CeedInt j = 0; j < Q; j++) array[field * Q + j] = 0.0;
+        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for assembling linear QFunction
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, bool build_objects, CeedVector *assembled, CeedElemRestriction *rstr,
+                                                              CeedRequest *request) {
+  Ceed                ceed, ceed_parent;
+  CeedInt             qf_size_in, qf_size_out, Q, num_elem, num_input_fields, num_output_fields;
+  CeedScalar         *assembled_array, *e_data_full[2 * CEED_FIELD_MAX] = {NULL};
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedQFunction       qf;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedOperator_Ref   *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetFallbackParentCeed(op, &ceed_parent));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Ref(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+
+  // Count number of active input and output fields
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSizes_Ref(op, num_input_fields, qf_input_fields, op_input_fields, num_output_fields,
+                                                               qf_output_fields, op_output_fields, impl));
+  qf_size_in  = impl->qf_size_in;
+  qf_size_out = impl->qf_size_out;
 
   // Build objects if needed
   if (build_objects) {
@@ -557,71 +736,12 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   // Loop through elements
   for (CeedInt e = 0; e < num_elem; e++) {
     // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, true, e_data_full, impl));
+    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, NULL, true, e_data_full, impl, request));
 
     // Assemble QFunction
-
-    for (CeedInt i = 0; i < num_input_fields; i++) {
-      bool       is_active;
-      CeedInt    field_size;
-      CeedVector vec;
-
-      // Set Inputs
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      is_active = vec == CEED_VECTOR_ACTIVE;
-      CeedCallBackend(CeedVectorDestroy(&vec));
-      if (!is_active) continue;
-      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &field_size));
-      for (CeedInt field = 0; field < field_size; field++) {
-        // Set current portion of input to 1.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q; j++) array[field * Q + j] = 1.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-
-        if (!impl->is_identity_qf) {
-          // Set Outputs
-          for (CeedInt out = 0; out < num_output_fields; out++) {
-            CeedVector vec;
-
-            // Get output vector
-            CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-            // Check if active output
-            if (vec == CEED_VECTOR_ACTIVE) {
-              CeedInt field_size;
-
-              CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, assembled_array));
-              CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &field_size));
-              assembled_array += field_size * Q;  // Advance the pointer by the size of the output
-            }
-            CeedCallBackend(CeedVectorDestroy(&vec));
-          }
-          // Apply QFunction
-          CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
-        } else {
-          CeedInt           field_size;
-          const CeedScalar *array;
-
-          // Copy Identity Outputs
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[0], &field_size));
-          CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_out[0], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < field_size * Q; j++) assembled_array[j] = array[j];
-          CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_out[0], &array));
-          assembled_array += field_size * Q;
-        }
-        // Reset input to 0.0
-        {
-          CeedScalar *array;
-
-          CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &array));
-          for (CeedInt j = 0; j < Q; j++) array[field * Q + j] = 0.0;
-          CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &array));
-        }
-      }
-    }
+    CeedCallBackend(CeedOperatorLinearAssembleQFunctionElement_Ref(Q, qf, qf_input_fields, op_input_fields, num_input_fields, qf_output_fields,
+                                                                   op_output_fields, num_output_fields, impl,
+                                                                   &assembled_array[(CeedSize)e * Q * qf_size_in * qf_size_out]));
   }
 
   // Un-set output Qvecs to prevent accidental overwrite of Assembled
@@ -661,6 +781,115 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Ref(CeedOperator op, CeedVe
   return CeedOperatorLinearAssembleQFunctionCore_Ref(op, false, &assembled, &rstr, request);
 }
 
+//------------------------------------------------------------------------------
+// Assemble Linear QFunction for a Block of Elements
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleQFunctionBlock_Ref(CeedOperator op, CeedInt e_start, CeedInt num_elem_block, void *ctx,
+                                                        CeedScalar *assembled_block, CeedRequest *request) {
+  CeedInt                   Q, num_input_fields, num_output_fields;
+  CeedQFunctionField       *qf_input_fields, *qf_output_fields;
+  CeedQFunction             qf;
+  CeedOperatorField        *op_input_fields, *op_output_fields;
+  CeedOperator_Ref         *impl;
+  CeedOperatorDiagonal_Ref *data = ctx;
+
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Input Evecs and Restriction
+  if (!data->is_setup) {
+    CeedCallBackend(
+        CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, data->e_data_full, impl, request));
+    data->is_setup = true;
+  }
+
+  // Loop through elements
+  for (CeedInt e = e_start; e < e_start + num_elem_block; e++) {
+    // Input basis apply
+    CeedCallBackend(
+        CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, NULL, true, data->e_data_full, impl, request));
+
+    // Assemble QFunction
+    CeedCallBackend(CeedOperatorLinearAssembleQFunctionElement_Ref(
+        Q, qf, qf_input_fields, op_input_fields, num_input_fields, qf_output_fields, op_output_fields, num_output_fields, impl,
+        &assembled_block[(CeedSize)(e - e_start) * Q * impl->qf_size_in * impl->qf_size_out]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Core code for assembling operator diagonal or point block diagonal
+//------------------------------------------------------------------------------
+static inline int CeedOperatorLinearAssembleAddDiagonalCore_Ref(CeedOperator op, bool is_point_block, CeedVector assembled, CeedRequest *request) {
+  Ceed                     ceed;
+  CeedInt                  Q, num_input_fields, num_output_fields;
+  CeedQFunctionField      *qf_input_fields, *qf_output_fields;
+  CeedQFunction            qf;
+  CeedOperatorField       *op_input_fields, *op_output_fields;
+  CeedOperator_Ref        *impl;
+  CeedOperatorDiagonal_Ref data = {false, {NULL}};
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Ref(op));
+
+  // Check for restriction only operator
+  CeedCheck(!impl->is_identity_rstr_op, ceed, CEED_ERROR_BACKEND, "Assembling restriction only operators is not supported");
+
+  // Count number of active input and output fields
+  CeedCallBackend(CeedOperatorLinearAssembleQFunctionSizes_Ref(op, num_input_fields, qf_input_fields, op_input_fields, num_output_fields,
+                                                               qf_output_fields, op_output_fields, impl));
+
+  // Assemble diagonal one element at a time
+  {
+    const CeedInt layout_block[3] = {1, Q, Q * impl->qf_size_in * impl->qf_size_out};
+
+    CeedCallBackend(CeedOperatorLinearAssembleAddDiagonalByBlock(op, 1, layout_block, CeedOperatorLinearAssembleQFunctionBlock_Ref, &data,
+                                                                 is_point_block, assembled, request));
+  }
+  if (!data.is_setup) return CEED_ERROR_SUCCESS;
+
+  // Un-set output Qvecs to prevent accidental overwrite of assembled data
+  if (!impl->is_identity_qf) {
+    for (CeedInt out = 0; out < num_output_fields; out++) {
+      CeedVector vec;
+
+      // Get output vector
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
+      // Check if active output
+      if (vec == CEED_VECTOR_ACTIVE) CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
+      CeedCallBackend(CeedVectorDestroy(&vec));
+    }
+  }
+
+  // Restore input arrays
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, data.e_data_full, impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddDiagonal_Ref(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Ref(op, false, assembled, request);
+}
+
+//------------------------------------------------------------------------------
+// Assemble Operator Point Block Diagonal
+//------------------------------------------------------------------------------
+static int CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref(CeedOperator op, CeedVector assembled, CeedRequest *request) {
+  return CeedOperatorLinearAssembleAddDiagonalCore_Ref(op, true, assembled, request);
+}
+
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
@@ -1527,6 +1756,208 @@ static int CeedOperatorLinearAssembleAddDiagonalAtPoints_Ref(CeedOperator op, Ce
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply with Element Matrices
+//------------------------------------------------------------------------------
+int CeedOperatorApplyAddElementMatrices_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  int                 ierr = CEED_ERROR_SUCCESS;
+  CeedInt             num_elem, elem_size_in, num_comp_in, elem_size_out, num_comp_out, layout_in[3], layout_out[3];
+  CeedSize            e_size_in, e_size_out, elem_mat_size;
+  const CeedScalar   *elem_mats, *e_array_in;
+  CeedScalar         *e_array_out;
+  Ceed                ceed;
+  CeedVector          e_vec_in, e_vec_out;
+  CeedBasis           basis_in;
+  CeedElemRestriction rstr_in, rstr_out;
+  CeedTensorContract  contract = NULL, contract_owned = NULL;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetElementMatrices(op, &rstr_in, &rstr_out, &elem_mats));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr_in, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr_in, &elem_size_in));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_in, &num_comp_in));
+  CeedCallBackend(CeedElemRestrictionGetELayout(rstr_in, layout_in));
+  CeedCallBackend(CeedElemRestrictionGetEVectorSize(rstr_in, &e_size_in));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr_out, &elem_size_out));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr_out, &num_comp_out));
+  CeedCallBackend(CeedElemRestrictionGetELayout(rstr_out, layout_out));
+  CeedCallBackend(CeedElemRestrictionGetEVectorSize(rstr_out, &e_size_out));
+  CeedCheck(layout_in[0] == 1 && layout_out[0] == 1 && layout_out[1] == elem_size_out, ceed, CEED_ERROR_BACKEND,
+            "Element matrix application requires contiguous element nodes");
+  elem_mat_size = (CeedSize)elem_size_out * elem_size_in;
+
+  // Contraction from active basis, if available
+  CeedCallBackend(CeedOperatorGetActiveBases(op, &basis_in, NULL));
+  if (basis_in != CEED_BASIS_NONE) CeedCallBackend(CeedBasisGetTensorContract(basis_in, &contract));
+  if (!contract) {
+    Ceed ceed_parent;
+
+    CeedCallBackend(CeedGetParent(ceed, &ceed_parent));
+    CeedCallBackend(CeedTensorContractCreate(ceed_parent, &contract_owned));
+    contract = contract_owned;
+  }
+
+  // Restrict active input
+  CeedCallBackend(CeedGetWorkVector(ceed, e_size_in, &e_vec_in));
+  CeedCallBackend(CeedGetWorkVector(ceed, e_size_out, &e_vec_out));
+  CeedCallBackend(CeedElemRestrictionApply(rstr_in, CEED_NOTRANSPOSE, in_vec, e_vec_in, request));
+
+  // Element matrix-vector products, one contraction per input component
+  CeedCallBackend(CeedVectorGetArrayRead(e_vec_in, CEED_MEM_HOST, &e_array_in));
+  CeedCallBackend(CeedVectorGetArrayWrite(e_vec_out, CEED_MEM_HOST, &e_array_out));
+  CeedPragmaOMP(parallel for schedule(static))
+  for (CeedInt e = 0; e < num_elem; e++) {
+    int         ierr_e = CEED_ERROR_SUCCESS;
+    CeedScalar *v      = &e_array_out[(CeedSize)e * layout_out[2]];
+
+    for (CeedInt comp_in = 0; comp_in < num_comp_in && ierr_e == CEED_ERROR_SUCCESS; comp_in++) {
+      const CeedScalar *u        = &e_array_in[comp_in * layout_in[1] + (CeedSize)e * layout_in[2]];
+      const CeedScalar *elem_mat = &elem_mats[((CeedSize)e * num_comp_in + comp_in) * num_comp_out * elem_mat_size];
+
+      ierr_e = CeedTensorContractApply(contract, 1, elem_size_in, 1, num_comp_out * elem_size_out, elem_mat, CEED_NOTRANSPOSE, comp_in > 0, u, v);
+    }
+    if (ierr_e != CEED_ERROR_SUCCESS) {
+      CeedPragmaCritical(CeedOperatorApplyAddElementMatrices_Ref) ierr = ierr_e;
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArrayRead(e_vec_in, &e_array_in));
+  CeedCallBackend(CeedVectorRestoreArray(e_vec_out, &e_array_out));
+  CeedCallBackend(ierr);
+
+  // Sum into active output
+  CeedCallBackend(CeedElemRestrictionApply(rstr_out, CEED_TRANSPOSE, e_vec_out, out_vec, request));
+
+  // Cleanup
+  CeedCallBackend(CeedRestoreWorkVector(ceed, &e_vec_in));
+  CeedCallBackend(CeedRestoreWorkVector(ceed, &e_vec_out));
+  CeedCallBackend(CeedTensorContractDestroy(&contract_owned));
+  CeedCallBackend(CeedBasisDestroy(&basis_in));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_in));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_out));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply for FDM Element Inverse
+//------------------------------------------------------------------------------
+int CeedOperatorApplyAddFDMElementInverse_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  int                 ierr = CEED_ERROR_SUCCESS, num_threads = 1;
+  CeedInt             num_elem, num_comp, dim, P_1d, num_nodes, layout[3], strides_scale[3];
+  CeedSize            e_size;
+  const CeedScalar   *fdm_interp_1d, *e_array_in, *scale_array;
+  CeedScalar         *e_array_out, *work;
+  Ceed                ceed;
+  CeedVector          scale, e_vec_in, e_vec_out;
+  CeedBasis           basis;
+  CeedElemRestriction rstr, rstr_scale;
+  CeedTensorContract  contract;
+  CeedOperatorField  *op_input_fields;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetFields(op, NULL, &op_input_fields, NULL, NULL));
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &rstr));
+  CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[0], &basis));
+  CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[1], &rstr_scale));
+  CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[1], &scale));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetELayout(rstr, layout));
+  CeedCallBackend(CeedElemRestrictionGetEVectorSize(rstr, &e_size));
+  CeedCallBackend(CeedElemRestrictionGetStrides(rstr_scale, strides_scale));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+  CeedCallBackend(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCallBackend(CeedBasisGetInterp1D(basis, &fdm_interp_1d));
+  CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
+  CeedCheck(contract, ceed, CEED_ERROR_BACKEND, "FDM element inverse application requires a CeedTensorContract for the eigenvector CeedBasis");
+  CeedCheck(layout[0] == 1 && layout[1] == num_nodes && strides_scale[0] == 1 && strides_scale[1] == num_nodes &&
+                strides_scale[2] == num_comp * num_nodes,
+            ceed, CEED_ERROR_BACKEND, "FDM element inverse application requires contiguous element nodes");
+
+  // Restrict active input
+  CeedCallBackend(CeedGetWorkVector(ceed, e_size, &e_vec_in));
+  CeedCallBackend(CeedGetWorkVector(ceed, e_size, &e_vec_out));
+  CeedCallBackend(CeedElemRestrictionApply(rstr, CEED_NOTRANSPOSE, in_vec, e_vec_in, request));
+
+  // Fused passes over blocks of elements
+  CeedCallBackend(CeedVectorGetArrayRead(e_vec_in, CEED_MEM_HOST, &e_array_in));
+  CeedCallBackend(CeedVectorGetArrayRead(scale, CEED_MEM_HOST, &scale_array));
+  CeedCallBackend(CeedVectorGetArrayWrite(e_vec_out, CEED_MEM_HOST, &e_array_out));
+  const CeedInt elem_size = num_comp * num_nodes, block_size = CEED_REF_FDM_BLOCK_SIZE;
+  const CeedInt num_blocks = (num_elem + block_size - 1) / block_size, work_size = elem_size * block_size;
+
+#ifdef _OPENMP
+  if (!omp_in_parallel()) num_threads = CeedIntMax(1, CeedIntMin(omp_get_max_threads(), num_blocks));
+#endif
+  CeedCallBackend(CeedCalloc(2 * work_size * num_threads, &work));
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedInt b = 0; b < num_blocks; b++) {
+#ifdef _OPENMP
+    const CeedInt t = omp_get_thread_num();
+#else
+    const CeedInt t = 0;
+#endif
+    int           ierr_t  = CEED_ERROR_SUCCESS;
+    const CeedInt e_start = b * block_size, num_elem_block = CeedIntMin(block_size, num_elem - e_start);
+    CeedInt       pre     = num_comp * CeedIntPow(P_1d, dim - 1), post = block_size;
+    CeedScalar   *tmp[2]  = {&work[2 * work_size * t], &work[(2 * t + 1) * work_size]};
+
+    // -- Interlace elements, so each contraction runs over the whole block
+    for (CeedInt k = 0; k < num_elem_block; k++) {
+      const CeedScalar *u = &e_array_in[(CeedSize)(e_start + k) * layout[2]];
+
+      for (CeedInt i = 0; i < elem_size; i++) tmp[0][i * block_size + k] = u[i];
+    }
+    // -- Interpolate to eigenvector coefficients
+    for (CeedInt d = 0; d < dim && ierr_t == CEED_ERROR_SUCCESS; d++) {
+      ierr_t = CeedTensorContractApply(contract, pre, P_1d, post, P_1d, fdm_interp_1d, CEED_NOTRANSPOSE, false, tmp[d % 2], tmp[(d + 1) % 2]);
+      pre /= P_1d;
+      post *= P_1d;
+    }
+    // -- Scale by inverse FDM diagonal
+    for (CeedInt k = 0; k < num_elem_block; k++) {
+      const CeedScalar *scale_elem = &scale_array[(CeedSize)(e_start + k) * elem_size];
+
+      for (CeedInt i = 0; i < elem_size; i++) tmp[dim % 2][i * block_size + k] *= scale_elem[i];
+    }
+    // -- Transform back to nodes
+    pre  = num_comp * CeedIntPow(P_1d, dim - 1);
+    post = block_size;
+    for (CeedInt d = 0; d < dim && ierr_t == CEED_ERROR_SUCCESS; d++) {
+      ierr_t = CeedTensorContractApply(contract, pre, P_1d, post, P_1d, fdm_interp_1d, CEED_TRANSPOSE, false, tmp[(dim + d) % 2],
+                                       tmp[(dim + d + 1) % 2]);
+      pre /= P_1d;
+      post *= P_1d;
+    }
+    // -- Deinterlace elements
+    for (CeedInt k = 0; k < num_elem_block; k++) {
+      CeedScalar *v = &e_array_out[(CeedSize)(e_start + k) * layout[2]];
+
+      for (CeedInt i = 0; i < elem_size; i++) v[i] = tmp[0][i * block_size + k];
+    }
+    if (ierr_t != CEED_ERROR_SUCCESS) {
+      CeedPragmaCritical(CeedOperatorApplyAddFDMElementInverse_Ref) ierr = ierr_t;
+    }
+  }
+  CeedCallBackend(CeedFree(&work));
+  CeedCallBackend(CeedVectorRestoreArrayRead(e_vec_in, &e_array_in));
+  CeedCallBackend(CeedVectorRestoreArrayRead(scale, &scale_array));
+  CeedCallBackend(CeedVectorRestoreArray(e_vec_out, &e_array_out));
+  CeedCallBackend(ierr);
+
+  // Sum into active output
+  CeedCallBackend(CeedElemRestrictionApply(rstr, CEED_TRANSPOSE, e_vec_out, out_vec, request));
+
+  // Cleanup
+  CeedCallBackend(CeedRestoreWorkVector(ceed, &e_vec_in));
+  CeedCallBackend(CeedRestoreWorkVector(ceed, &e_vec_out));
+  CeedCallBackend(CeedVectorDestroy(&scale));
+  CeedCallBackend(CeedBasisDestroy(&basis));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr));
+  CeedCallBackend(CeedElemRestrictionDestroy(&rstr_scale));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -1575,7 +2006,12 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
   CeedCallBackend(CeedOperatorSetData(op, impl));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddDiagonal", CeedOperatorLinearAssembleAddDiagonal_Ref));
+  CeedCallBackend(
+      CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleAddPointBlockDiagonal", CeedOperatorLinearAssembleAddPointBlockDiagonal_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddElementMatrices", CeedOperatorApplyAddElementMatrices_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddFDMElementInverse", CeedOperatorApplyAddFDMElementInverse_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Ref));
   return CEED_ERROR_SUCCESS;
 }
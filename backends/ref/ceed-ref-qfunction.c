@@ -8,15 +8,114 @@
 #include <ceed.h>
 #include <ceed/backend.h>
 #include <stddef.h>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "ceed-ref.h"
 
+#ifdef _OPENMP
+//------------------------------------------------------------------------------
+// QFunction Apply on a Chunk of Quadrature Points
+//   User QFunctions use the number of points as the component stride, so each
+//   chunk is packed into contiguous scratch before calling the user function
+//------------------------------------------------------------------------------
+static int CeedQFunctionApplyChunk_Ref(CeedQFunctionUser f, void *ctx_data, CeedInt Q, CeedInt q_start, CeedInt q_size, CeedInt num_in,
+                                       const CeedInt *sizes_in, const CeedScalar *const *inputs, CeedInt num_out, const CeedInt *sizes_out,
+                                       CeedScalar *const *outputs, CeedScalar *scratch) {
+  const CeedScalar *chunk_in[CEED_FIELD_MAX];
+  CeedScalar       *chunk_out[CEED_FIELD_MAX];
+
+  for (CeedInt i = 0; i < num_in; i++) {
+    CeedScalar *chunk = scratch;
+
+    for (CeedInt c = 0; c < sizes_in[i]; c++) memcpy(&chunk[c * q_size], &inputs[i][(CeedSize)c * Q + q_start], q_size * sizeof(CeedScalar));
+    chunk_in[i] = chunk;
+    scratch += (CeedSize)sizes_in[i] * q_size;
+  }
+  for (CeedInt i = 0; i < num_out; i++) {
+    chunk_out[i] = scratch;
+    scratch += (CeedSize)sizes_out[i] * q_size;
+  }
+  CeedCallBackend(f(ctx_data, q_size, chunk_in, chunk_out));
+  for (CeedInt i = 0; i < num_out; i++) {
+    for (CeedInt c = 0; c < sizes_out[i]; c++) memcpy(&outputs[i][(CeedSize)c * Q + q_start], &chunk_out[i][c * q_size], q_size * sizeof(CeedScalar));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// QFunction Apply Split Across Threads
+//------------------------------------------------------------------------------
+static int CeedQFunctionApplyThreaded_Ref(CeedQFunction qf, CeedInt Q, CeedInt num_chunks, CeedQFunctionUser f, void *ctx_data,
+                                          CeedQFunctionContextDataReduceUser f_reduce, CeedQFunction_Ref *impl) {
+  int                 ierr     = CEED_ERROR_SUCCESS;
+  size_t              ctx_size = 0;
+  CeedInt             num_in, num_out, vec_length, chunk_size, sizes_in[CEED_FIELD_MAX], sizes_out[CEED_FIELD_MAX];
+  CeedSize            scratch_size = 0;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+
+  CeedCallBackend(CeedQFunctionGetFields(qf, &num_in, &qf_input_fields, &num_out, &qf_output_fields));
+  for (CeedInt i = 0; i < num_in; i++) CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &sizes_in[i]));
+  for (CeedInt i = 0; i < num_out; i++) CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &sizes_out[i]));
+
+  // Chunks are aligned to the vector length
+  CeedCallBackend(CeedQFunctionGetVectorLength(qf, &vec_length));
+  chunk_size = (Q + num_chunks - 1) / num_chunks;
+  chunk_size = ((chunk_size + vec_length - 1) / vec_length) * vec_length;
+  num_chunks = (Q + chunk_size - 1) / chunk_size;
+
+  // Thread scratch
+  for (CeedInt i = 0; i < num_in; i++) scratch_size += (CeedSize)sizes_in[i] * chunk_size;
+  for (CeedInt i = 0; i < num_out; i++) scratch_size += (CeedSize)sizes_out[i] * chunk_size;
+  if (impl->thread_q_size < scratch_size * num_chunks) {
+    impl->thread_q_size = scratch_size * num_chunks;
+    CeedCallBackend(CeedFree(&impl->thread_q));
+    CeedCallBackend(CeedMalloc(impl->thread_q_size, &impl->thread_q));
+  }
+
+  // Private copies of writable context data, followed by the initial context data
+  if (f_reduce) {
+    CeedQFunctionContext ctx;
+
+    CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+    CeedCallBackend(CeedQFunctionContextGetContextSize(ctx, &ctx_size));
+    if (impl->thread_ctx_size < ctx_size * (num_chunks + 1)) {
+      impl->thread_ctx_size = ctx_size * (num_chunks + 1);
+      CeedCallBackend(CeedFree(&impl->thread_ctx));
+      CeedCallBackend(CeedMalloc(impl->thread_ctx_size, &impl->thread_ctx));
+    }
+    for (CeedInt t = 0; t <= num_chunks; t++) memcpy(&impl->thread_ctx[t * ctx_size], ctx_data, ctx_size);
+  }
+
+  CeedPragmaOMP(parallel for num_threads(num_chunks) schedule(static, 1))
+  for (CeedInt t = 0; t < num_chunks; t++) {
+    const CeedInt q_start    = t * chunk_size, q_size = CeedIntMin(chunk_size, Q - q_start);
+    void         *ctx_data_t = f_reduce ? (void *)&impl->thread_ctx[t * ctx_size] : ctx_data;
+    const int     ierr_t     = CeedQFunctionApplyChunk_Ref(f, ctx_data_t, Q, q_start, q_size, num_in, sizes_in, impl->inputs, num_out, sizes_out,
+                                                           impl->outputs, &impl->thread_q[t * scratch_size]);
+
+    if (ierr_t != CEED_ERROR_SUCCESS) {
+      CeedPragmaCritical(CeedQFunctionApplyThreaded_Ref) ierr = ierr_t;
+    }
+  }
+  CeedCallBackend(ierr);
+
+  // Combine private context data in thread order
+  for (CeedInt t = 0; t < num_chunks && f_reduce; t++) {
+    CeedCallBackend(f_reduce(ctx_data, &impl->thread_ctx[t * ctx_size], &impl->thread_ctx[num_chunks * ctx_size]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+#endif
+
 //------------------------------------------------------------------------------
 // QFunction Apply
 //------------------------------------------------------------------------------
 static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q, CeedVector *U, CeedVector *V) {
-  void              *ctx_data = NULL;
-  CeedInt            num_in, num_out;
+  void              *ctx_data   = NULL;
+  CeedInt            num_chunks = 1, num_in, num_out;
   CeedQFunctionUser  f = NULL;
   CeedQFunction_Ref *impl;
 
@@ -32,7 +131,24 @@ static int CeedQFunctionApply_Ref(CeedQFunction qf, CeedInt Q, CeedVector *U, Ce
     CeedCallBackend(CeedVectorGetArrayWrite(V[i], CEED_MEM_HOST, &impl->outputs[i]));
   }
 
-  CeedCallBackend(f(ctx_data, Q, impl->inputs, impl->outputs));
+#ifdef _OPENMP
+  // Split quadrature points across threads unless already in a parallel region
+  CeedQFunctionContextDataReduceUser f_reduce = NULL;
+
+  if (!omp_in_parallel()) num_chunks = CeedIntMax(1, CeedIntMin(omp_get_max_threads(), Q / CEED_REF_QF_MIN_CHUNK));
+  if (num_chunks > 1 && ctx_data) {
+    bool                 is_writable;
+    CeedQFunctionContext ctx;
+
+    // Writable contexts need a reduction for private thread copies
+    CeedCallBackend(CeedQFunctionIsContextWritable(qf, &is_writable));
+    CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+    if (is_writable) CeedCallBackend(CeedQFunctionContextGetDataReduce(ctx, &f_reduce));
+    if (is_writable && !f_reduce) num_chunks = 1;
+  }
+  if (num_chunks > 1) CeedCallBackend(CeedQFunctionApplyThreaded_Ref(qf, Q, num_chunks, f, ctx_data, f_reduce, impl));
+#endif
+  if (num_chunks == 1) CeedCallBackend(f(ctx_data, Q, impl->inputs, impl->outputs));
 
   for (CeedInt i = 0; i < num_in; i++) {
     CeedCallBackend(CeedVectorRestoreArrayRead(U[i], &impl->inputs[i]));
@@ -53,6 +169,8 @@ static int CeedQFunctionDestroy_Ref(CeedQFunction qf) {
   CeedCallBackend(CeedQFunctionGetData(qf, &impl));
   CeedCallBackend(CeedFree(&impl->inputs));
   CeedCallBackend(CeedFree(&impl->outputs));
+  CeedCallBackend(CeedFree(&impl->thread_q));
+  CeedCallBackend(CeedFree(&impl->thread_ctx));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -13,6 +13,68 @@
 
 #include "ceed-ref.h"
 
+//------------------------------------------------------------------------------
+// Compute transpose offsets, mapping each L-vector node to the E-vector nodes that feed it
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionOffset_Ref(CeedElemRestriction rstr) {
+  bool                    *is_node;
+  CeedSize                 l_size;
+  CeedInt                  num_elem, num_block, block_size, elem_size, num_nodes = 0;
+  CeedInt                 *ind_to_offset, *l_vec_indices, *t_offsets, *t_indices;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCallBackend(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  const CeedInt  block_elem_size = block_size * elem_size;
+  const CeedSize size_indices    = (CeedSize)num_block * block_elem_size;
+
+  // Count num_nodes, skipping padding elements
+  CeedCallBackend(CeedCalloc(l_size, &is_node));
+  for (CeedSize i = 0; i < size_indices; i++) {
+    if ((i / block_elem_size) * block_size + i % block_size < num_elem) is_node[impl->offsets[i]] = true;
+  }
+  for (CeedSize i = 0; i < l_size; i++) num_nodes += is_node[i];
+
+  // L-vector offsets array
+  CeedCallBackend(CeedCalloc(l_size, &ind_to_offset));
+  CeedCallBackend(CeedCalloc(num_nodes, &l_vec_indices));
+  for (CeedSize i = 0, j = 0; i < l_size; i++) {
+    if (is_node[i]) {
+      l_vec_indices[j] = i;
+      ind_to_offset[i] = j++;
+    }
+  }
+  CeedCallBackend(CeedFree(&is_node));
+
+  // Compute transpose offsets and indices
+  CeedCallBackend(CeedCalloc(num_nodes + 1, &t_offsets));
+  CeedCallBackend(CeedMalloc((CeedSize)num_elem * elem_size, &t_indices));
+  // Count node multiplicity
+  for (CeedSize i = 0; i < size_indices; i++) {
+    if ((i / block_elem_size) * block_size + i % block_size < num_elem) ++t_offsets[ind_to_offset[impl->offsets[i]] + 1];
+  }
+  // Convert to running sum
+  for (CeedInt i = 1; i <= num_nodes; i++) t_offsets[i] += t_offsets[i - 1];
+  // List all positions in offsets associated with L-vector node
+  for (CeedSize i = 0; i < size_indices; i++) {
+    if ((i / block_elem_size) * block_size + i % block_size < num_elem) t_indices[t_offsets[ind_to_offset[impl->offsets[i]]]++] = i;
+  }
+  // Reset running sum
+  for (CeedInt i = num_nodes; i > 0; i--) t_offsets[i] = t_offsets[i - 1];
+  t_offsets[0] = 0;
+  CeedCallBackend(CeedFree(&ind_to_offset));
+
+  impl->num_nodes     = num_nodes;
+  impl->l_vec_indices = l_vec_indices;
+  impl->t_indices     = t_indices;
+  impl->t_offsets     = t_offsets;
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Core ElemRestriction Apply Code
 //------------------------------------------------------------------------------
@@ -367,6 +429,36 @@ static inline int CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core
   return CEED_ERROR_SUCCESS;
 }
 
+static inline int CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
+                                                                         const CeedInt comp_stride, CeedInt elem_size, bool use_signs,
+                                                                         const CeedScalar *__restrict__ uu, CeedScalar *__restrict__ vv) {
+  // Restriction with offsets, each L-vector node gathers its E-vector nodes
+  int                      ierr = CEED_ERROR_SUCCESS;
+  CeedElemRestriction_Ref *impl;
+
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  CeedPragmaCritical(CeedElemRestrictionOffset_Ref) {
+    if (!impl->t_offsets) ierr = CeedElemRestrictionOffset_Ref(rstr);
+  }
+  CeedCallBackend(ierr);
+  const CeedInt  num_nodes = impl->num_nodes, block_elem_size = block_size * elem_size;
+  const CeedInt *t_offsets = impl->t_offsets, *t_indices = impl->t_indices, *l_vec_indices = impl->l_vec_indices;
+  const bool    *orients   = use_signs ? impl->orients : NULL;
+
+  CeedPragmaOMP(parallel for) for (CeedInt n = 0; n < num_nodes; n++) {
+    CeedScalar *vv_node = &vv[l_vec_indices[n]];
+
+    for (CeedInt j = t_offsets[n]; j < t_offsets[n + 1]; j++) {
+      const CeedInt     ind  = t_indices[j];
+      const CeedScalar  sign = orients && orients[ind] ? -1.0 : 1.0;
+      const CeedScalar *uu_j = &uu[(CeedSize)(ind / block_elem_size) * block_elem_size * num_comp + ind % block_elem_size];
+
+      CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) vv_node[k * comp_stride] += sign * uu_j[k * block_elem_size];
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, CeedInt start, CeedInt stop,
                                                                      CeedTransposeMode t_mode, const CeedScalar *__restrict__ uu,
                                                                      CeedScalar *__restrict__ vv) {
@@ -395,13 +487,14 @@ static inline int CeedElemRestrictionApplyAtPointsInElement_Ref_Core(CeedElemRes
 static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, const CeedInt num_comp, const CeedInt block_size,
                                                     const CeedInt comp_stride, CeedInt start, CeedInt stop, CeedTransposeMode t_mode, bool use_signs,
                                                     bool use_orients, CeedVector u, CeedVector v, CeedRequest *request) {
-  CeedInt             num_elem, elem_size;
+  CeedInt             num_elem, num_block, elem_size;
   CeedSize            v_offset = 0;
   CeedRestrictionType rstr_type;
   const CeedScalar   *uu;
   CeedScalar         *vv;
 
   CeedCallBackend(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
   CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
   v_offset = start * block_size * elem_size * (CeedSize)num_comp;
   CeedCallBackend(CeedElemRestrictionGetType(rstr, &rstr_type));
@@ -420,17 +513,27 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
     // uu has shape [elem_size, num_comp, num_elem], row-major
     // vv has shape [nnodes, num_comp]
     // Sum into for transpose mode
+    // Offset restrictions applied to all elements gather into each L-vector node instead of scattering
+    const bool is_gather = start == 0 && stop == num_block;
+
     switch (rstr_type) {
       case CEED_RESTRICTION_STRIDED:
         CeedCallBackend(
             CeedElemRestrictionApplyStridedTranspose_Ref_Core(rstr, num_comp, block_size, start, stop, num_elem, elem_size, v_offset, uu, vv));
         break;
       case CEED_RESTRICTION_STANDARD:
-        CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
-                                                                         v_offset, uu, vv));
+        if (is_gather) {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(rstr, num_comp, block_size, comp_stride, elem_size, false, uu, vv));
+        } else {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
+                                                                           v_offset, uu, vv));
+        }
         break;
       case CEED_RESTRICTION_ORIENTED:
-        if (use_signs) {
+        if (is_gather) {
+          CeedCallBackend(
+              CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(rstr, num_comp, block_size, comp_stride, elem_size, use_signs, uu, vv));
+        } else if (use_signs) {
           CeedCallBackend(CeedElemRestrictionApplyOrientedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem,
                                                                              elem_size, v_offset, uu, vv));
         } else {
@@ -445,6 +548,8 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction rstr, co
         } else if (use_orients) {
           CeedCallBackend(CeedElemRestrictionApplyCurlOrientedUnsignedTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop,
                                                                                          num_elem, elem_size, v_offset, uu, vv));
+        } else if (is_gather) {
+          CeedCallBackend(CeedElemRestrictionApplyOffsetTransposeGather_Ref_Core(rstr, num_comp, block_size, comp_stride, elem_size, false, uu, vv));
         } else {
           CeedCallBackend(CeedElemRestrictionApplyOffsetTranspose_Ref_Core(rstr, num_comp, block_size, comp_stride, start, stop, num_elem, elem_size,
                                                                            v_offset, uu, vv));
@@ -711,6 +816,9 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction rstr) {
   CeedCallBackend(CeedFree(&impl->offsets_owned));
   CeedCallBackend(CeedFree(&impl->orients_owned));
   CeedCallBackend(CeedFree(&impl->curl_orients_owned));
+  CeedCallBackend(CeedFree(&impl->t_offsets));
+  CeedCallBackend(CeedFree(&impl->t_indices));
+  CeedCallBackend(CeedFree(&impl->l_vec_indices));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
@@ -7,6 +7,7 @@
 
 #include <ceed.h>
 #include <ceed/backend.h>
+#include <math.h>
 #include <stdbool.h>
 #include <string.h>
 
@@ -119,6 +120,192 @@ static int CeedVectorRestoreArray_Ref(CeedVector vec) { return CEED_ERROR_SUCCES
 //------------------------------------------------------------------------------
 static int CeedVectorRestoreArrayRead_Ref(CeedVector vec) { return CEED_ERROR_SUCCESS; }
 
+//------------------------------------------------------------------------------
+// Block Bounds
+//------------------------------------------------------------------------------
+static inline CeedSize CeedVectorBlockEnd_Ref(CeedSize block, CeedSize length) {
+  const CeedSize end = (block + 1) * CEED_REF_VEC_BLOCK_SIZE;
+
+  return end < length ? end : length;
+}
+
+//------------------------------------------------------------------------------
+// Norm of a Block
+//   Independent partial sums vectorize without reassociating floating point
+//   operations and accumulate less rounding error than a single running sum
+//------------------------------------------------------------------------------
+static inline CeedScalar CeedHostNormBlock_Ref(const CeedScalar *array, CeedSize length, CeedNormType norm_type) {
+  CeedSize   i                                = 0;
+  CeedScalar partial[CEED_REF_VEC_NORM_LANES] = {0.}, block_norm = 0.;
+
+  switch (norm_type) {
+    case CEED_NORM_1:
+      for (; i + CEED_REF_VEC_NORM_LANES <= length; i += CEED_REF_VEC_NORM_LANES) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < CEED_REF_VEC_NORM_LANES; j++) partial[j] += fabs(array[i + j]);
+      }
+      for (; i < length; i++) partial[0] += fabs(array[i]);
+      break;
+    case CEED_NORM_2:
+      for (; i + CEED_REF_VEC_NORM_LANES <= length; i += CEED_REF_VEC_NORM_LANES) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < CEED_REF_VEC_NORM_LANES; j++) partial[j] += array[i + j] * array[i + j];
+      }
+      for (; i < length; i++) partial[0] += array[i] * array[i];
+      break;
+    case CEED_NORM_MAX:
+      for (; i + CEED_REF_VEC_NORM_LANES <= length; i += CEED_REF_VEC_NORM_LANES) {
+        CeedPragmaSIMD for (CeedInt j = 0; j < CEED_REF_VEC_NORM_LANES; j++) {
+          const CeedScalar abs_v = fabs(array[i + j]);
+
+          partial[j] = partial[j] > abs_v ? partial[j] : abs_v;
+        }
+      }
+      for (; i < length; i++) partial[0] = partial[0] > fabs(array[i]) ? partial[0] : fabs(array[i]);
+      for (CeedInt j = 0; j < CEED_REF_VEC_NORM_LANES; j++) block_norm = block_norm > partial[j] ? block_norm : partial[j];
+      return block_norm;
+  }
+  for (CeedInt j = 0; j < CEED_REF_VEC_NORM_LANES; j++) block_norm += partial[j];
+  return block_norm;
+}
+
+//------------------------------------------------------------------------------
+// Vector Norm
+//   Block sums are combined with Kahan compensated summation, so the rounding
+//   error does not grow with the vector length
+//------------------------------------------------------------------------------
+static int CeedVectorNorm_Ref(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
+  CeedSize          length, num_blocks;
+  CeedScalar        norm_value = 0.;
+  const CeedScalar *array;
+
+  CeedCallBackend(CeedVectorGetLength(vec, &length));
+  CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &array));
+  num_blocks = (length + CEED_REF_VEC_BLOCK_SIZE - 1) / CEED_REF_VEC_BLOCK_SIZE;
+  if (norm_type == CEED_NORM_MAX) {
+    CeedPragmaOMP(parallel for if (length >= CEED_REF_VEC_MIN_PARALLEL) reduction(max : norm_value) schedule(static))
+    for (CeedSize b = 0; b < num_blocks; b++) {
+      const CeedSize   start      = b * CEED_REF_VEC_BLOCK_SIZE;
+      const CeedScalar block_norm = CeedHostNormBlock_Ref(&array[start], CeedVectorBlockEnd_Ref(b, length) - start, norm_type);
+
+      norm_value = norm_value > block_norm ? norm_value : block_norm;
+    }
+  } else {
+    CeedPragmaOMP(parallel if (length >= CEED_REF_VEC_MIN_PARALLEL) reduction(+ : norm_value)) {
+      CeedScalar sum = 0., compensation = 0.;
+
+      CeedPragmaOMP(for schedule(static))
+      for (CeedSize b = 0; b < num_blocks; b++) {
+        const CeedSize   start     = b * CEED_REF_VEC_BLOCK_SIZE;
+        const CeedScalar block_sum = CeedHostNormBlock_Ref(&array[start], CeedVectorBlockEnd_Ref(b, length) - start, norm_type) - compensation;
+        const CeedScalar new_sum   = sum + block_sum;
+
+        compensation = (new_sum - sum) - block_sum;
+        sum          = new_sum;
+      }
+      norm_value += sum;
+    }
+  }
+  CeedCallBackend(CeedVectorRestoreArrayRead(vec, &array));
+  *norm = norm_type == CEED_NORM_2 ? sqrt(norm_value) : norm_value;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Compute x = alpha x
+//------------------------------------------------------------------------------
+static int CeedVectorScale_Ref(CeedVector x, CeedScalar alpha) {
+  CeedSize    length, num_blocks;
+  CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(x, &length));
+  CeedCallBackend(CeedVectorGetArray(x, CEED_MEM_HOST, &x_array));
+  num_blocks = (length + CEED_REF_VEC_BLOCK_SIZE - 1) / CEED_REF_VEC_BLOCK_SIZE;
+  CeedPragmaOMP(parallel for if (length >= CEED_REF_VEC_MIN_PARALLEL) schedule(static))
+  for (CeedSize b = 0; b < num_blocks; b++) {
+    const CeedSize end = CeedVectorBlockEnd_Ref(b, length);
+
+    CeedPragmaSIMD for (CeedSize i = b * CEED_REF_VEC_BLOCK_SIZE; i < end; i++) x_array[i] *= alpha;
+  }
+  CeedCallBackend(CeedVectorRestoreArray(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPY_Ref(CeedVector y, CeedScalar alpha, CeedVector x) {
+  CeedSize          length, num_blocks;
+  CeedScalar       *y_array;
+  const CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(y, &length));
+  CeedCallBackend(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  num_blocks = (length + CEED_REF_VEC_BLOCK_SIZE - 1) / CEED_REF_VEC_BLOCK_SIZE;
+  CeedPragmaOMP(parallel for if (length >= CEED_REF_VEC_MIN_PARALLEL) schedule(static))
+  for (CeedSize b = 0; b < num_blocks; b++) {
+    const CeedSize end = CeedVectorBlockEnd_Ref(b, length);
+
+    CeedPragmaSIMD for (CeedSize i = b * CEED_REF_VEC_BLOCK_SIZE; i < end; i++) y_array[i] += alpha * x_array[i];
+  }
+  CeedCallBackend(CeedVectorRestoreArray(y, &y_array));
+  CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Compute y = alpha x + beta y
+//------------------------------------------------------------------------------
+static int CeedVectorAXPBY_Ref(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x) {
+  CeedSize          length, num_blocks;
+  CeedScalar       *y_array;
+  const CeedScalar *x_array;
+
+  CeedCallBackend(CeedVectorGetLength(y, &length));
+  CeedCallBackend(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  num_blocks = (length + CEED_REF_VEC_BLOCK_SIZE - 1) / CEED_REF_VEC_BLOCK_SIZE;
+  CeedPragmaOMP(parallel for if (length >= CEED_REF_VEC_MIN_PARALLEL) schedule(static))
+  for (CeedSize b = 0; b < num_blocks; b++) {
+    const CeedSize end = CeedVectorBlockEnd_Ref(b, length);
+
+    CeedPragmaSIMD for (CeedSize i = b * CEED_REF_VEC_BLOCK_SIZE; i < end; i++) y_array[i] = alpha * x_array[i] + beta * y_array[i];
+  }
+  CeedCallBackend(CeedVectorRestoreArray(y, &y_array));
+  CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Compute the pointwise multiplication w = x .* y
+//------------------------------------------------------------------------------
+static int CeedVectorPointwiseMult_Ref(CeedVector w, CeedVector x, CeedVector y) {
+  CeedSize          length, num_blocks;
+  CeedScalar       *w_array;
+  const CeedScalar *x_array, *y_array;
+
+  CeedCallBackend(CeedVectorGetLength(w, &length));
+  if (x == w || y == w) {
+    CeedCallBackend(CeedVectorGetArray(w, CEED_MEM_HOST, &w_array));
+  } else {
+    CeedCallBackend(CeedVectorGetArrayWrite(w, CEED_MEM_HOST, &w_array));
+  }
+  if (x != w) CeedCallBackend(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  else x_array = w_array;
+  if (y != w && y != x) CeedCallBackend(CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array));
+  else y_array = y == x ? x_array : w_array;
+  num_blocks = (length + CEED_REF_VEC_BLOCK_SIZE - 1) / CEED_REF_VEC_BLOCK_SIZE;
+  CeedPragmaOMP(parallel for if (length >= CEED_REF_VEC_MIN_PARALLEL) schedule(static))
+  for (CeedSize b = 0; b < num_blocks; b++) {
+    const CeedSize end = CeedVectorBlockEnd_Ref(b, length);
+
+    CeedPragmaSIMD for (CeedSize i = b * CEED_REF_VEC_BLOCK_SIZE; i < end; i++) w_array[i] = x_array[i] * y_array[i];
+  }
+  if (y != w && y != x) CeedCallBackend(CeedVectorRestoreArrayRead(y, &y_array));
+  if (x != w) CeedCallBackend(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCallBackend(CeedVectorRestoreArray(w, &w_array));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Vector Destroy
 //------------------------------------------------------------------------------
@@ -148,6 +335,11 @@ int CeedVectorCreate_Ref(CeedSize n, CeedVector vec) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "GetArrayWrite", CeedVectorGetArrayWrite_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArray", CeedVectorRestoreArray_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "RestoreArrayRead", CeedVectorRestoreArrayRead_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "Norm", CeedVectorNorm_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "Scale", CeedVectorScale_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "AXPY", CeedVectorAXPY_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "AXPBY", CeedVectorAXPBY_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "PointwiseMult", CeedVectorPointwiseMult_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Vector", vec, "Destroy", CeedVectorDestroy_Ref));
   CeedCallBackend(CeedCalloc(1, &impl));
   CeedCallBackend(CeedVectorSetData(vec, impl));
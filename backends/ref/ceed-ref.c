@@ -11,14 +11,40 @@
 #include <ceed/backend.h>
 #include <string.h>
 
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Ref(Ceed ceed) {
+  Ceed_Ref *data;
+
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedFree(&data));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Ref(const char *resource, Ceed ceed) {
-  CeedCheck(!strcmp(resource, "/cpu/self") || !strcmp(resource, "/cpu/self/ref") || !strcmp(resource, "/cpu/self/ref/serial"), ceed,
-            CEED_ERROR_BACKEND, "Ref backend cannot use resource: %s", resource);
+  char     *resource_root;
+  Ceed_Ref *data;
+
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  const char *resource_spec = &resource[strlen(resource_root)];
+  const bool  is_streaming  = !strcmp(resource_spec, ":stream");
+
+  CeedCheck((!strcmp(resource_root, "/cpu/self") || !strcmp(resource_root, "/cpu/self/ref") || !strcmp(resource_root, "/cpu/self/ref/serial")) &&
+                (!resource_spec[0] || is_streaming),
+            ceed, CEED_ERROR_BACKEND, "Ref backend cannot use resource: %s", resource);
+  CeedCallBackend(CeedFree(&resource_root));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
+  // Streaming operators restrict one element at a time instead of storing full E-vectors
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->is_streaming = is_streaming;
+  CeedCallBackend(CeedSetData(ceed, data));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "VectorCreate", CeedVectorCreate_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateTensorH1", CeedBasisCreateTensorH1_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "BasisCreateH1", CeedBasisCreateH1_Ref));
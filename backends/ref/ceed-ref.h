@@ -11,6 +11,19 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+typedef struct {
+  bool is_streaming; /* Operators restrict one element at a time instead of storing full E-vectors */
+} Ceed_Ref;
+
+// Number of entries per block in CeedVector arithmetic; blocks are distributed across threads
+#define CEED_REF_VEC_BLOCK_SIZE 1024
+// Minimum CeedVector length for splitting arithmetic across threads
+#define CEED_REF_VEC_MIN_PARALLEL 65536
+// Number of independent partial sums per block in CeedVector norms
+#define CEED_REF_VEC_NORM_LANES 8
+// Number of elements interlaced in each fused pass of the FDM element inverse
+#define CEED_REF_FDM_BLOCK_SIZE 8
+
 typedef struct {
   CeedScalar *array;
   CeedScalar *array_borrowed;
@@ -27,6 +40,10 @@ typedef struct {
   const CeedInt8 *curl_orients; /* Tridiagonal matrix (row-major) for a general transformation during restriction */
   const CeedInt8 *curl_orients_borrowed;
   const CeedInt8 *curl_orients_owned;
+  CeedInt         num_nodes;     /* Number of L-vector nodes touched by offsets, set with transpose offsets */
+  CeedInt        *t_offsets;     /* Transpose offsets, CSR row pointers for each L-vector node */
+  CeedInt        *t_indices;     /* Transpose indices, positions in offsets feeding each L-vector node */
+  CeedInt        *l_vec_indices; /* L-vector node for each row of transpose offsets */
   int (*Apply)(CeedElemRestriction, CeedInt, CeedInt, CeedInt, CeedInt, CeedInt, CeedTransposeMode, bool, bool, CeedVector, CeedVector,
                CeedRequest *);
 } CeedElemRestriction_Ref;
@@ -36,9 +53,16 @@ typedef struct {
   bool        has_collo_interp;
 } CeedBasis_Ref;
 
+// Minimum number of quadrature points per thread when splitting CeedQFunction application
+#define CEED_REF_QF_MIN_CHUNK 256
+
 typedef struct {
   const CeedScalar **inputs;
   CeedScalar       **outputs;
+  CeedScalar        *thread_q;   /* Packed input and output chunks for each thread */
+  CeedSize           thread_q_size;
+  char              *thread_ctx; /* Private copies of writable context data for each thread */
+  size_t             thread_ctx_size;
 } CeedQFunction_Ref;
 
 typedef struct {
@@ -48,7 +72,7 @@ typedef struct {
 } CeedQFunctionContext_Ref;
 
 typedef struct {
-  bool        is_identity_qf, is_identity_rstr_op;
+  bool        is_identity_qf, is_identity_rstr_op, is_streaming;
   bool       *skip_rstr_in, *skip_rstr_out, *apply_add_basis_out;
   CeedInt    *e_data_out_indices;
   uint64_t   *input_states; /* State counter of inputs */
@@ -62,6 +86,11 @@ typedef struct {
   CeedVector  point_coords_elem;
 } CeedOperator_Ref;
 
+typedef struct {
+  bool        is_setup;                        /* Input E-vectors are set up when the first element block is assembled */
+  CeedScalar *e_data_full[2 * CEED_FIELD_MAX]; /* Input E-vector arrays */
+} CeedOperatorDiagonal_Ref;
+
 CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orients,
@@ -84,3 +113,5 @@ CEED_INTERN int CeedQFunctionContextCreate_Ref(CeedQFunctionContext ctx);
 
 CEED_INTERN int CeedOperatorCreate_Ref(CeedOperator op);
 CEED_INTERN int CeedOperatorCreateAtPoints_Ref(CeedOperator op);
+CEED_INTERN int CeedOperatorApplyAddElementMatrices_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request);
+CEED_INTERN int CeedOperatorApplyAddFDMElementInverse_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request);
@@ -0,0 +1,217 @@
+/// @file
+/// Benchmark for CeedOperatorApply on the CEED bake-off problems BP1-BP6, without PETSc or MPI
+///
+/// Builds the BP operators with the gallery CeedQFunctions on a structured box mesh of hexahedral elements, sweeps the polynomial degree and
+/// problem size, and reports DoFs/s and GFLOP/s of repeated CeedOperatorApply.
+/// The output is read by `postprocess_table.py` and `postprocess_plot.py`.
+///
+/// Sample runs:
+///
+///     ./build/ceed-bps /cpu/self/opt/blocked
+///     ./build/ceed-bps /cpu/self/avx/blocked 3 8 1000000
+///
+/// The optional arguments are the BP number (default: all), the highest degree (default: 8), and the largest number of DoFs (default: 3*2^20).
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// BP problem data
+typedef struct {
+  CeedInt      num_comp, q_data_size, q_extra;
+  CeedQuadMode quad_mode;
+  const char  *setup_name, *apply_name, *in_name, *out_name;
+} BPData;
+
+static const BPData bp_data[6] = {
+    {1, 1, 1, CEED_GAUSS,         "Mass3DBuild",    "MassApply",             "u",  "v" },
+    {3, 1, 1, CEED_GAUSS,         "Mass3DBuild",    "Vector3MassApply",      "u",  "v" },
+    {1, 6, 1, CEED_GAUSS,         "Poisson3DBuild", "Poisson3DApply",        "du", "dv"},
+    {3, 6, 1, CEED_GAUSS,         "Poisson3DBuild", "Vector3Poisson3DApply", "du", "dv"},
+    {1, 6, 0, CEED_GAUSS_LOBATTO, "Poisson3DBuild", "Poisson3DApply",        "du", "dv"},
+    {3, 6, 0, CEED_GAUSS_LOBATTO, "Poisson3DBuild", "Vector3Poisson3DApply", "du", "dv"},
+};
+
+// Wall time in seconds
+static double GetTime(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + 1e-9 * (double)time.tv_nsec;
+}
+
+// Create the restriction for a degree p H1 space with num_comp components on a structured mesh of hexahedral elements
+static int CreateRestriction(Ceed ceed, const CeedInt num_elem_1d[3], CeedInt p, CeedInt num_comp, CeedElemRestriction *rstr) {
+  const CeedInt num_nodes_1d[3] = {num_elem_1d[0] * p + 1, num_elem_1d[1] * p + 1, num_elem_1d[2] * p + 1};
+  const CeedInt num_elem = num_elem_1d[0] * num_elem_1d[1] * num_elem_1d[2], elem_size = (p + 1) * (p + 1) * (p + 1);
+  const CeedInt num_nodes = num_nodes_1d[0] * num_nodes_1d[1] * num_nodes_1d[2];
+  CeedInt      *offsets   = malloc(sizeof(CeedInt) * num_elem * elem_size);
+
+  for (CeedInt e = 0; e < num_elem; e++) {
+    const CeedInt e_xyz[3] = {e % num_elem_1d[0], (e / num_elem_1d[0]) % num_elem_1d[1], e / (num_elem_1d[0] * num_elem_1d[1])};
+
+    for (CeedInt k = 0; k < p + 1; k++) {
+      for (CeedInt j = 0; j < p + 1; j++) {
+        for (CeedInt i = 0; i < p + 1; i++) {
+          offsets[e * elem_size + (k * (p + 1) + j) * (p + 1) + i] =
+              ((e_xyz[2] * p + k) * num_nodes_1d[1] + e_xyz[1] * p + j) * num_nodes_1d[0] + e_xyz[0] * p + i;
+        }
+      }
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_COPY_VALUES, offsets, rstr);
+  free(offsets);
+  return CEED_ERROR_SUCCESS;
+}
+
+// Run one BP for one degree and mesh size
+static int RunBP(Ceed ceed, const char *resource, CeedInt bp, CeedInt p, const CeedInt num_elem_1d[3], double min_time) {
+  const BPData       *data = &bp_data[bp - 1];
+  const CeedInt       dim = 3, P = p + 1, Q = P + data->q_extra, num_comp = data->num_comp;
+  const CeedInt       num_elem = num_elem_1d[0] * num_elem_1d[1] * num_elem_1d[2];
+  const CeedInt       num_vertices = (num_elem_1d[0] + 1) * (num_elem_1d[1] + 1) * (num_elem_1d[2] + 1);
+  const CeedInt       num_nodes = (num_elem_1d[0] * p + 1) * (num_elem_1d[1] * p + 1) * (num_elem_1d[2] * p + 1);
+  const CeedInt       num_qpts = Q * Q * Q;
+  CeedInt             num_reps = 0;
+  CeedSize            flops;
+  CeedMemType         mem_type;
+  double              elapsed;
+  CeedElemRestriction rstr_x, rstr_u, rstr_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_apply;
+  CeedOperator        op_setup, op_apply;
+  CeedVector          x, q_data, u, v;
+
+  // Mesh coordinates on the unit cube
+  CeedVectorCreate(ceed, dim * num_vertices, &x);
+  {
+    CeedScalar *x_array;
+
+    CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+    for (CeedInt n = 0; n < num_vertices; n++) {
+      const CeedInt n_xyz[3] = {n % (num_elem_1d[0] + 1), (n / (num_elem_1d[0] + 1)) % (num_elem_1d[1] + 1),
+                                n / ((num_elem_1d[0] + 1) * (num_elem_1d[1] + 1))};
+
+      for (CeedInt d = 0; d < dim; d++) x_array[d * num_vertices + n] = (CeedScalar)n_xyz[d] / num_elem_1d[d];
+    }
+    CeedVectorRestoreArray(x, &x_array);
+  }
+
+  // Restrictions and bases
+  CreateRestriction(ceed, num_elem_1d, 1, dim, &rstr_x);
+  CreateRestriction(ceed, num_elem_1d, p, num_comp, &rstr_u);
+  CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, data->q_data_size, (CeedSize)num_elem * num_qpts * data->q_data_size,
+                                   CEED_STRIDES_BACKEND, &rstr_q_data);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, data->quad_mode, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, P, Q, data->quad_mode, &basis_u);
+
+  // Geometric factors
+  CeedQFunctionCreateInteriorByName(ceed, data->setup_name, &qf_setup);
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "dx", rstr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "qdata", rstr_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+  CeedElemRestrictionCreateVector(rstr_q_data, &q_data, NULL);
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // BP operator
+  CeedQFunctionCreateInteriorByName(ceed, data->apply_name, &qf_apply);
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, data->in_name, rstr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "qdata", rstr_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_apply, data->out_name, rstr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorGetFlopsEstimate(op_apply, &flops);
+  CeedElemRestrictionCreateVector(rstr_u, &u, NULL);
+  CeedElemRestrictionCreateVector(rstr_u, &v, NULL);
+  CeedVectorSetValue(u, 1.0);
+
+  // Warm up, then repeat until the minimum time is reached
+  CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    const double      start = GetTime();
+    const CeedScalar *v_array;
+
+    do {
+      CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+      num_reps++;
+      elapsed = GetTime() - start;
+    } while (elapsed < min_time);
+    // Wait for the last application to finish
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorRestoreArrayRead(v, &v_array);
+    elapsed = GetTime() - start;
+  }
+
+  CeedGetPreferredMemType(ceed, &mem_type);
+  printf("\n-- CEED Benchmark Problem %" CeedInt_FMT " -- libCEED --\n"
+         "  Run:\n"
+         "    Total ranks                             : 1\n"
+         "    Ranks per compute node                  : 1\n"
+         "  libCEED:\n"
+         "    libCEED Backend                         : %s\n"
+         "    libCEED Backend MemType                 : %s\n"
+         "  Mesh:\n"
+         "    Basis Nodes                             : %" CeedInt_FMT "\n"
+         "    Quadrature Points                       : %" CeedInt_FMT "\n"
+         "    Global nodes                            : %" CeedInt_FMT "\n"
+         "    Local Elements                          : %" CeedInt_FMT " (%" CeedInt_FMT " x %" CeedInt_FMT " x %" CeedInt_FMT ")\n"
+         "    DoF per node                            : %" CeedInt_FMT "\n"
+         "  Performance:\n"
+         "    Operator Applications                   : %" CeedInt_FMT "\n"
+         "    Operator Apply Time                     : %g sec\n"
+         "    DoFs/Sec in Operator Apply              : %g million\n"
+         "    GFLOP/s in Operator Apply               : %g\n",
+         bp, resource, CeedMemTypes[mem_type], P, Q, num_nodes, num_elem, num_elem_1d[0], num_elem_1d[1], num_elem_1d[2], num_comp, num_reps,
+         elapsed, 1e-6 * num_comp * num_nodes * num_reps / elapsed, 1e-9 * flops * num_reps / elapsed);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&rstr_x);
+  CeedElemRestrictionDestroy(&rstr_u);
+  CeedElemRestrictionDestroy(&rstr_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_apply);
+  return CEED_ERROR_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  Ceed          ceed;
+  const char   *resource = argc > 1 ? argv[1] : "/cpu/self";
+  const CeedInt bp_min = argc > 2 ? atoi(argv[2]) : 1, bp_max = argc > 2 ? atoi(argv[2]) : 6;
+  const CeedInt p_max    = argc > 3 ? atoi(argv[3]) : 8;
+  const double  max_dofs = argc > 4 ? atof(argv[4]) : 3 * (1 << 20), min_dofs = 1000, min_time = 0.1;
+
+  if (bp_min < 1 || bp_max > 6 || p_max < 1) {
+    // LCOV_EXCL_START
+    printf("Usage: %s [ceed-resource] [bp: 1-6] [max degree] [max DoFs]\n", argv[0]);
+    return 1;
+    // LCOV_EXCL_STOP
+  }
+  CeedInit(resource, &ceed);
+
+  for (CeedInt bp = bp_min; bp <= bp_max; bp++) {
+    for (CeedInt p = 1; p <= p_max; p++) {
+      // Refine one direction at a time, roughly doubling the problem size
+      CeedInt num_elem_1d[3] = {1, 1, 1};
+
+      for (CeedInt refine = 0;; refine++) {
+        const double num_dofs =
+            (double)bp_data[bp - 1].num_comp * (num_elem_1d[0] * p + 1) * (num_elem_1d[1] * p + 1) * (num_elem_1d[2] * p + 1);
+
+        if (num_dofs > max_dofs) break;
+        if (num_dofs >= min_dofs) RunBP(ceed, resource, bp, p, num_elem_1d, min_time);
+        num_elem_1d[refine % 3] *= 2;
+      }
+    }
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,310 @@
+/// @file
+/// Micro-benchmarks for CeedTensorContractApply, CeedBasisApply, and CeedElemRestrictionApply
+///
+/// Times each kernel over a sweep of sizes for every resource given on the command line and writes GFLOP/s and the bandwidth of the minimum
+/// data movement as JSON, for tracking performance between releases.
+/// Kernel families may be selected by name, `contract`, `basis`, or `restriction`; all are run by default.
+///
+/// Sample runs:
+///
+///     ./build/ceed-kernels /cpu/self/opt/blocked
+///     ./build/ceed-kernels /cpu/self/ref/serial /cpu/self/avx/blocked basis > kernels.json
+#define _POSIX_C_SOURCE 200112
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Minimum time per measurement, in seconds
+#define MIN_TIME 0.02
+
+// Wall time in seconds
+static double GetTime(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + 1e-9 * (double)time.tv_nsec;
+}
+
+// Write the timing fields of one result and close the JSON object
+static void PrintResult(bool *is_first, CeedInt num_reps, double elapsed, double flops, double bytes) {
+  printf(", \"reps\": %" CeedInt_FMT ", \"time\": %.6e, \"gflops\": %.4f, \"bandwidth_gb_s\": %.4f}", num_reps, elapsed / num_reps,
+         1e-9 * flops * num_reps / elapsed, 1e-9 * bytes * num_reps / elapsed);
+  *is_first = false;
+}
+
+// Time CeedTensorContractApply for the contractions of a 3D interpolation and its transpose, for P in 2..10 and Q in P..11
+static int BenchContract(Ceed ceed, bool *is_first) {
+  const CeedInt      p_min = 2, p_max = 10, num_lanes_max = 8;
+  CeedTensorContract contract;
+  CeedScalar        *t, *u, *v;
+
+  CeedCall(CeedTensorContractCreate(ceed, &contract));
+  t = calloc(p_max * (p_max + 1), sizeof(*t));
+  u = calloc((p_max + 1) * (p_max + 1) * (p_max + 1) * num_lanes_max, sizeof(*u));
+  v = calloc((p_max + 1) * (p_max + 1) * (p_max + 1) * num_lanes_max, sizeof(*v));
+  for (CeedInt i = 0; i < p_max * (p_max + 1); i++) t[i] = 1.0 / (1 + i);
+  for (CeedInt i = 0; i < (p_max + 1) * (p_max + 1) * (p_max + 1) * num_lanes_max; i++) u[i] = 1.0 / (1 + i % 17);
+
+  for (CeedInt num_lanes = 1; num_lanes <= num_lanes_max; num_lanes *= num_lanes_max) {
+    for (CeedInt P = p_min; P <= p_max; P++) {
+      for (CeedInt Q = P; Q <= p_max + 1; Q++) {
+        for (CeedInt mode = 0; mode < 2; mode++) {
+          const CeedTransposeMode t_mode = mode ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+          const CeedInt           in = mode ? Q : P, out = mode ? P : Q;
+
+          for (CeedInt d = 0; d < 3; d++) {
+            CeedInt A = 1, C = num_lanes;
+
+            for (CeedInt i = 0; i < 2 - d; i++) A *= in;
+            for (CeedInt i = 0; i < d; i++) C *= out;
+            for (CeedInt add = 0; add < 2; add++) {
+              const double flops = 2.0 * A * in * C * out;
+              const double bytes = sizeof(CeedScalar) * ((double)in * out + (double)A * in * C + (1.0 + add) * A * out * C);
+              CeedInt      num_reps = 0;
+              double       elapsed = 0.0, start;
+
+              CeedCall(CeedTensorContractApply(contract, A, in, C, out, t, t_mode, add, u, v));
+              start = GetTime();
+              for (CeedInt batch = 1; elapsed < MIN_TIME; batch *= 2) {
+                for (CeedInt r = 0; r < batch; r++) CeedCall(CeedTensorContractApply(contract, A, in, C, out, t, t_mode, add, u, v));
+                num_reps += batch;
+                elapsed = GetTime() - start;
+              }
+              printf("%s\n      {\"kernel\": \"CeedTensorContractApply\", \"A\": %" CeedInt_FMT ", \"B\": %" CeedInt_FMT ", \"C\": %" CeedInt_FMT
+                     ", \"J\": %" CeedInt_FMT ", \"t_mode\": \"%s\", \"add\": %s",
+                     *is_first ? "" : ",", A, in, C, out, CeedTransposeModes[t_mode], add ? "true" : "false");
+              PrintResult(is_first, num_reps, elapsed, flops, bytes);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  free(t);
+  free(u);
+  free(v);
+  CeedCall(CeedTensorContractDestroy(&contract));
+  return CEED_ERROR_SUCCESS;
+}
+
+// Time CeedBasisApply for tensor product H1 Lagrange bases, on a single element and on a block of 8 elements as in the CPU operators
+static int BenchBasis(Ceed ceed, bool *is_first) {
+  const CeedInt      p_min = 2, p_max = 8, num_elem_list[2] = {1, 8};
+  const CeedEvalMode eval_modes[3] = {CEED_EVAL_INTERP, CEED_EVAL_GRAD, CEED_EVAL_WEIGHT};
+
+  for (CeedInt dim = 1; dim <= 3; dim++) {
+    for (CeedInt P = p_min; P <= p_max; P++) {
+      const CeedInt Q = P + 1;
+      CeedBasis     basis;
+      CeedInt       num_nodes, num_qpts;
+
+      CeedCall(CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &basis));
+      CeedCall(CeedBasisGetNumNodes(basis, &num_nodes));
+      CeedCall(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+      for (CeedInt n = 0; n < 2; n++) {
+        const CeedInt num_elem = num_elem_list[n];
+
+        for (CeedInt m = 0; m < 3; m++) {
+          const CeedEvalMode eval_mode = eval_modes[m];
+
+          for (CeedInt mode = 0; mode < (eval_mode == CEED_EVAL_WEIGHT ? 1 : 2); mode++) {
+            const CeedTransposeMode t_mode = mode ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+            const CeedSize          e_size = (CeedSize)num_elem * num_nodes, q_size = (CeedSize)num_elem * num_qpts * (m == 1 ? dim : 1);
+            CeedInt                 num_reps = 0;
+            CeedSize                flops;
+            double                  elapsed = 0.0, start;
+            CeedVector              u = CEED_VECTOR_NONE, v;
+
+            if (eval_mode != CEED_EVAL_WEIGHT) {
+              CeedCall(CeedVectorCreate(ceed, t_mode == CEED_TRANSPOSE ? q_size : e_size, &u));
+              CeedCall(CeedVectorSetValue(u, 1.0));
+            }
+            CeedCall(CeedVectorCreate(ceed, t_mode == CEED_TRANSPOSE ? e_size : q_size, &v));
+            CeedCall(CeedBasisGetFlopsEstimate(basis, t_mode, eval_mode, &flops));
+
+            CeedCall(CeedBasisApply(basis, num_elem, t_mode, eval_mode, u, v));
+            start = GetTime();
+            for (CeedInt batch = 1; elapsed < MIN_TIME; batch *= 2) {
+              for (CeedInt r = 0; r < batch; r++) CeedCall(CeedBasisApply(basis, num_elem, t_mode, eval_mode, u, v));
+              num_reps += batch;
+              // Wait for the last application to finish
+              {
+                const CeedScalar *v_array;
+
+                CeedCall(CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array));
+                CeedCall(CeedVectorRestoreArrayRead(v, &v_array));
+              }
+              elapsed = GetTime() - start;
+            }
+            printf("%s\n      {\"kernel\": \"CeedBasisApply\", \"dim\": %" CeedInt_FMT ", \"P\": %" CeedInt_FMT ", \"Q\": %" CeedInt_FMT
+                   ", \"num_elem\": %" CeedInt_FMT ", \"eval_mode\": \"%s\", \"t_mode\": \"%s\"",
+                   *is_first ? "" : ",", dim, P, Q, num_elem, CeedEvalModes[eval_mode], CeedTransposeModes[t_mode]);
+            PrintResult(is_first, num_reps, elapsed, (double)flops * num_elem,
+                        sizeof(CeedScalar) * (double)(eval_mode == CEED_EVAL_WEIGHT ? q_size : e_size + q_size));
+            CeedCall(CeedVectorDestroy(&u));
+            CeedCall(CeedVectorDestroy(&v));
+          }
+        }
+      }
+      CeedCall(CeedBasisDestroy(&basis));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+// Time CeedElemRestrictionApply for each restriction type on a structured mesh of hexahedral elements
+static int BenchRestriction(Ceed ceed, bool *is_first) {
+  const CeedInt     num_elem_1d = 16, num_elem = num_elem_1d * num_elem_1d * num_elem_1d, p_list[3] = {1, 2, 4};
+  const char *const rstr_types[4] = {"strided", "standard", "oriented", "curl-oriented"};
+
+  for (CeedInt n = 0; n < 3; n++) {
+    const CeedInt p = p_list[n], num_nodes_1d = num_elem_1d * p + 1, elem_size = (p + 1) * (p + 1) * (p + 1);
+    const CeedInt num_nodes = num_nodes_1d * num_nodes_1d * num_nodes_1d;
+    CeedInt      *offsets;
+    bool         *orients;
+    CeedInt8     *curl_orients;
+
+    // Offsets of a continuous H1 space, with orientations and tridiagonal transformations for the oriented restrictions
+    offsets      = calloc(num_elem * elem_size, sizeof(*offsets));
+    orients      = calloc(num_elem * elem_size, sizeof(*orients));
+    curl_orients = calloc(3 * num_elem * elem_size, sizeof(*curl_orients));
+    for (CeedInt e = 0; e < num_elem; e++) {
+      const CeedInt e_xyz[3] = {e % num_elem_1d, (e / num_elem_1d) % num_elem_1d, e / (num_elem_1d * num_elem_1d)};
+
+      for (CeedInt k = 0; k < p + 1; k++) {
+        for (CeedInt j = 0; j < p + 1; j++) {
+          for (CeedInt i = 0; i < p + 1; i++) {
+            const CeedInt index = e * elem_size + (k * (p + 1) + j) * (p + 1) + i;
+
+            offsets[index] = ((e_xyz[2] * p + k) * num_nodes_1d + e_xyz[1] * p + j) * num_nodes_1d + e_xyz[0] * p + i;
+            orients[index] = (i + j + k) % 2;
+          }
+        }
+      }
+      for (CeedInt i = 0; i < elem_size; i++) {
+        curl_orients[3 * (e * elem_size + i) + 0] = i > 0 ? -1 : 0;
+        curl_orients[3 * (e * elem_size + i) + 1] = 1;
+        curl_orients[3 * (e * elem_size + i) + 2] = i < elem_size - 1 ? -1 : 0;
+      }
+    }
+
+    for (CeedInt num_comp = 1; num_comp <= 3; num_comp += 2) {
+      for (CeedInt type = 0; type < 4; type++) {
+        const CeedSize      l_size = (CeedSize)num_comp * (type == 0 ? num_elem * elem_size : num_nodes);
+        const CeedSize      e_size = (CeedSize)num_comp * num_elem * elem_size;
+        const double        index_bytes = type == 0 ? 0.0 : (double)num_elem * elem_size * sizeof(CeedInt);
+        const double        orient_bytes = type == 2 ? (double)num_elem * elem_size * sizeof(bool)
+                                                     : (type == 3 ? 3.0 * num_elem * elem_size * sizeof(CeedInt8) : 0.0);
+        CeedElemRestriction rstr;
+        CeedVector          l_vec, e_vec;
+
+        switch (type) {
+          case 0:
+            CeedCall(CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, num_comp, l_size, CEED_STRIDES_BACKEND, &rstr));
+            break;
+          case 1:
+            CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, num_nodes, l_size, CEED_MEM_HOST, CEED_USE_POINTER, offsets,
+                                               &rstr));
+            break;
+          case 2:
+            CeedCall(CeedElemRestrictionCreateOriented(ceed, num_elem, elem_size, num_comp, num_nodes, l_size, CEED_MEM_HOST, CEED_USE_POINTER,
+                                                       offsets, orients, &rstr));
+            break;
+          default:
+            CeedCall(CeedElemRestrictionCreateCurlOriented(ceed, num_elem, elem_size, num_comp, num_nodes, l_size, CEED_MEM_HOST, CEED_USE_POINTER,
+                                                           offsets, curl_orients, &rstr));
+            break;
+        }
+        CeedCall(CeedElemRestrictionCreateVector(rstr, &l_vec, &e_vec));
+        CeedCall(CeedVectorSetValue(l_vec, 1.0));
+        CeedCall(CeedVectorSetValue(e_vec, 1.0));
+
+        for (CeedInt mode = 0; mode < 2; mode++) {
+          const CeedTransposeMode t_mode = mode ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+          CeedVector              u = mode ? e_vec : l_vec, v = mode ? l_vec : e_vec;
+          CeedInt                 num_reps = 0;
+          CeedSize                flops;
+          double                  elapsed = 0.0, start;
+
+          CeedCall(CeedElemRestrictionGetFlopsEstimate(rstr, t_mode, &flops));
+          CeedCall(CeedElemRestrictionApply(rstr, t_mode, u, v, CEED_REQUEST_IMMEDIATE));
+          start = GetTime();
+          for (CeedInt batch = 1; elapsed < MIN_TIME; batch *= 2) {
+            for (CeedInt r = 0; r < batch; r++) CeedCall(CeedElemRestrictionApply(rstr, t_mode, u, v, CEED_REQUEST_IMMEDIATE));
+            num_reps += batch;
+            // Wait for the last application to finish
+            {
+              const CeedScalar *v_array;
+
+              CeedCall(CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array));
+              CeedCall(CeedVectorRestoreArrayRead(v, &v_array));
+            }
+            elapsed = GetTime() - start;
+          }
+          printf("%s\n      {\"kernel\": \"CeedElemRestrictionApply\", \"type\": \"%s\", \"elem_size\": %" CeedInt_FMT ", \"num_comp\": %" CeedInt_FMT
+                 ", \"num_elem\": %" CeedInt_FMT ", \"t_mode\": \"%s\"",
+                 *is_first ? "" : ",", rstr_types[type], elem_size, num_comp, num_elem, CeedTransposeModes[t_mode]);
+          // The transpose reads and writes the L-vector
+          PrintResult(is_first, num_reps, elapsed, (double)flops,
+                      sizeof(CeedScalar) * ((double)e_size + (1.0 + mode) * l_size) + index_bytes + orient_bytes);
+        }
+        CeedCall(CeedVectorDestroy(&l_vec));
+        CeedCall(CeedVectorDestroy(&e_vec));
+        CeedCall(CeedElemRestrictionDestroy(&rstr));
+      }
+    }
+    free(offsets);
+    free(orients);
+    free(curl_orients);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  bool    run_contract = false, run_basis = false, run_restriction = false, is_first_resource = true;
+  CeedInt num_resources = 0;
+
+  // Arguments starting with '/' are resources, others select kernel families
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '/') num_resources++;
+    else if (!strcmp(argv[i], "contract")) run_contract = true;
+    else if (!strcmp(argv[i], "basis")) run_basis = true;
+    else if (!strcmp(argv[i], "restriction")) run_restriction = true;
+    else {
+      // LCOV_EXCL_START
+      fprintf(stderr, "Usage: %s [ceed-resource ...] [contract] [basis] [restriction]\n", argv[0]);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+  }
+  if (!run_contract && !run_basis && !run_restriction) run_contract = run_basis = run_restriction = true;
+
+  printf("{\n  \"scalar_size\": %zu,\n  \"min_time\": %g,\n  \"runs\": [", sizeof(CeedScalar), MIN_TIME);
+  for (int i = num_resources ? 1 : 0; i < (num_resources ? argc : 1); i++) {
+    const char *resource = num_resources ? argv[i] : "/cpu/self";
+    bool        is_first = true;
+    Ceed        ceed;
+
+    if (num_resources && argv[i][0] != '/') continue;
+    CeedInit(resource, &ceed);
+    {
+      const char *used_resource;
+
+      CeedGetResource(ceed, &used_resource);
+      printf("%s\n    {\"resource\": \"%s\", \"results\": [", is_first_resource ? "" : ",", used_resource);
+    }
+    if (run_contract) BenchContract(ceed, &is_first);
+    if (run_basis) BenchBasis(ceed, &is_first);
+    if (run_restriction) BenchRestriction(ceed, &is_first);
+    printf("\n    ]}");
+    is_first_resource = false;
+    CeedDestroy(&ceed);
+  }
+  printf("\n  ]\n}\n");
+  return 0;
+}
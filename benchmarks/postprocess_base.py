@@ -100,6 +100,17 @@ def read_logs(files=None):
         elif 'DoFs/Sec in CG' in line or 'DOFs/Sec in CG' in line:
             data['cg_iteration_dps'] = 1e6 * \
                 float(line.split(':')[1].split()[0])
+        # Operator apply only runs, from ceed-bps
+        elif 'Operator Applications' in line:
+            data['ksp_its'] = int(line.split(':')[1].split()[0])
+        elif 'Operator Apply Time' in line:
+            data['time_per_it'] = float(
+                line.split(':')[1].split()[0]) / data['ksp_its']
+        elif 'DoFs/Sec in Operator Apply' in line:
+            data['cg_iteration_dps'] = 1e6 * \
+                float(line.split(':')[1].split()[0])
+        elif 'GFLOP/s in Operator Apply' in line:
+            data['gflops'] = float(line.split(':')[1].split()[0])
         # End of output
 
     return pd.DataFrame(runs)
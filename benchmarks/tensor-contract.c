@@ -0,0 +1,101 @@
+/// @file
+/// Micro-benchmark for CeedTensorContractApply
+///
+/// Times the sequence of tensor contractions of a 3D tensor product interpolation and its transpose for P, Q in 2..10.
+/// The element batch is interlaced in the last index, as in the blocked backends.
+///
+/// Sample runs:
+///
+///     ./build/tensor-contract /cpu/self/avx/serial
+///     ./build/tensor-contract /cpu/self/avx/blocked 8
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Apply the dim contractions of an interpolation, or its transpose, to one batch of elements
+static int ApplyInterp(CeedTensorContract contract, CeedInt dim, CeedInt P, CeedInt Q, CeedInt num_lanes, const CeedScalar *interp_1d,
+                       CeedTransposeMode t_mode, CeedScalar *tmp[2], const CeedScalar *u, CeedScalar *v) {
+  const CeedInt in = t_mode == CEED_TRANSPOSE ? Q : P, out = t_mode == CEED_TRANSPOSE ? P : Q;
+  CeedInt       pre = 1, post = num_lanes;
+
+  for (CeedInt d = 0; d < dim - 1; d++) pre *= in;
+  for (CeedInt d = 0; d < dim; d++) {
+    CeedCall(CeedTensorContractApply(contract, pre, in, post, out, interp_1d, t_mode, false, d == 0 ? u : tmp[d % 2],
+                                     d == dim - 1 ? v : tmp[(d + 1) % 2]));
+    pre /= in;
+    post *= out;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  Ceed               ceed;
+  CeedTensorContract contract;
+  const CeedInt      dim = 3, p_min = 2, p_max = 10;
+  const CeedInt      num_lanes = argc > 2 ? atoi(argv[2]) : 1;
+  const double       min_time  = 0.05;
+
+  CeedInit(argc > 1 ? argv[1] : "/cpu/self", &ceed);
+  CeedTensorContractCreate(ceed, &contract);
+
+  printf("# %s, %" CeedInt_FMT " interlaced element%s\n", argc > 1 ? argv[1] : "/cpu/self", num_lanes, num_lanes == 1 ? "" : "s");
+  printf("# %4s %4s %14s %14s\n", "P", "Q", "interp GF/s", "transpose GF/s");
+  for (CeedInt P = p_min; P <= p_max; P++) {
+    for (CeedInt Q = P; Q <= p_max; Q++) {
+      CeedInt     size = num_lanes;
+      CeedScalar *interp_1d, *u, *v, *tmp[2];
+      double      gflops[2];
+
+      for (CeedInt d = 0; d < dim; d++) size *= p_max;
+      interp_1d = malloc(sizeof(CeedScalar) * P * Q);
+      u         = malloc(sizeof(CeedScalar) * size);
+      v         = malloc(sizeof(CeedScalar) * size);
+      tmp[0]    = malloc(sizeof(CeedScalar) * size);
+      tmp[1]    = malloc(sizeof(CeedScalar) * size);
+      for (CeedInt i = 0; i < P * Q; i++) interp_1d[i] = 1.0 / (1 + i);
+      for (CeedInt i = 0; i < size; i++) u[i] = 1.0 / (1 + i % 17);
+
+      for (CeedInt mode = 0; mode < 2; mode++) {
+        const CeedTransposeMode t_mode = mode ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+        const CeedInt           in = mode ? Q : P, out = mode ? P : Q;
+        double                  flops = 0.0, elapsed = 0.0;
+        CeedInt                 num_reps = 0;
+        clock_t                 start;
+
+        // Count flops of one application
+        {
+          double pre = 1.0, post = num_lanes;
+
+          for (CeedInt d = 0; d < dim - 1; d++) pre *= in;
+          for (CeedInt d = 0; d < dim; d++) {
+            flops += 2.0 * pre * in * post * out;
+            pre /= in;
+            post *= out;
+          }
+        }
+        // Warm up, then repeat until the minimum time is reached
+        ApplyInterp(contract, dim, P, Q, num_lanes, interp_1d, t_mode, tmp, u, v);
+        start = clock();
+        for (CeedInt batch = 1; elapsed < min_time; batch *= 2) {
+          for (CeedInt r = 0; r < batch; r++) ApplyInterp(contract, dim, P, Q, num_lanes, interp_1d, t_mode, tmp, u, v);
+          num_reps += batch;
+          elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+        }
+        gflops[mode] = 1e-9 * flops * num_reps / elapsed;
+      }
+      printf("  %4" CeedInt_FMT " %4" CeedInt_FMT " %14.2f %14.2f\n", P, Q, gflops[0], gflops[1]);
+
+      free(interp_1d);
+      free(u);
+      free(v);
+      free(tmp[0]);
+      free(tmp[1]);
+    }
+  }
+
+  CeedTensorContractDestroy(&contract);
+  CeedDestroy(&ceed);
+  return 0;
+}
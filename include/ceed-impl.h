@@ -15,6 +15,12 @@
 
 CEED_INTERN const char *CeedJitSourceRootDefault;
 
+CEED_INTERN int CeedOperatorIsElementMatrixApply(CeedOperator op, bool *is_elem_mat_apply);
+CEED_INTERN int CeedOperatorIsFDMElementInverseApply(CeedOperator op, bool *is_fdm_apply);
+
+CEED_INTERN int CeedProfileCountersView(Ceed ceed, const char *object_name, const char *pre, FILE *stream);
+CEED_INTERN int CeedProfileDestroy(Ceed ceed);
+
 /** @defgroup CeedUser Public API for Ceed
     @ingroup Ceed
 */
@@ -90,6 +96,65 @@ struct CeedWorkVectors_private {
   CeedVector *vecs;
 };
 
+// Basis projection matrix cache
+#define CEED_BASIS_PROJECTION_CACHE_SIZE 16 /* Least recently used projections are evicted beyond this count */
+
+typedef struct {
+  uint64_t    hash;
+  CeedInt     header[7]; /* Tensor flag, FE space, dimension, quadrature points, quadrature components, and nodes of target and source */
+  CeedSize    key_size, interp_size, grad_size;
+  CeedScalar *key; /* Source matrices the projection was computed from */
+  CeedScalar *interp_project, *grad_project;
+} CeedBasisProjection;
+
+typedef struct CeedBasisProjections_private *CeedBasisProjections;
+struct CeedBasisProjections_private {
+  CeedInt              num_projections;
+  CeedBasisProjection *projections; /* Ordered from least to most recently used */
+};
+
+// Profiling of interface function calls
+#define CEED_PROFILE_NUM_COUNTERS 5 /* Cycles, instructions, L1D misses, LLC misses, and FP ops */
+
+typedef struct {
+  const char *event_name;  /* Name of the interface function */
+  char       *object_name; /* Name of the `CeedOperator` the calls belong to, if any */
+  CeedInt     count;
+  double      time;                                /* Inclusive wall time in seconds */
+  CeedSize    bytes;                               /* Bytes of input and output data */
+  uint64_t    counters[CEED_PROFILE_NUM_COUNTERS]; /* Inclusive hardware counter totals */
+} CeedProfileStage;
+
+typedef struct {
+  CeedInt     stage;
+  double      start_time;
+  uint64_t    start_counters[CEED_PROFILE_NUM_COUNTERS];
+  const char *object_name;
+} CeedProfileFrame;
+
+typedef struct {
+  CeedInt stage, thread;
+  double  start_time, duration;
+} CeedProfileTraceEvent;
+
+typedef struct CeedProfile_private *CeedProfile;
+struct CeedProfile_private {
+  bool                   is_profiling, is_view_on_destroy, use_counters;
+  char                  *trace_file_name;
+  int                    counter_fds[CEED_PROFILE_NUM_COUNTERS];   /* Hardware counter group, leader first */
+  CeedInt                counter_index[CEED_PROFILE_NUM_COUNTERS]; /* Position of each counter in the group, -1 if unavailable */
+  CeedInt                num_counters;
+  double                 start_time;
+  CeedInt                num_stages, max_stages;
+  CeedInt                num_frames, max_frames;
+  CeedInt                num_trace_events, max_trace_events;
+  CeedProfileStage      *stages;
+  CeedProfileFrame      *frames;
+  CeedProfileTraceEvent *trace_events;
+  CeedInt                num_threads, max_threads; /* Threads of the current threaded region, and allocated per-thread profiles */
+  CeedProfile           *threads;                  /* Per-thread profiles, merged into this profile after each threaded region */
+};
+
 struct Ceed_private {
   const char  *resource;
   Ceed         delegate;
@@ -121,14 +186,17 @@ struct Ceed_private {
   int (*OperatorCreate)(CeedOperator);
   int (*OperatorCreateAtPoints)(CeedOperator);
   int (*CompositeOperatorCreate)(CeedOperator);
-  int             ref_count;
-  void           *data;
-  bool            is_debug;
-  bool            has_valid_op_fallback_resource;
-  bool            is_deterministic;
-  char            err_msg[CEED_MAX_RESOURCE_LEN];
-  FOffset        *f_offsets;
-  CeedWorkVectors work_vectors;
+  int                  ref_count;
+  void                *data;
+  bool                 is_debug;
+  bool                 has_valid_op_fallback_resource;
+  bool                 is_deterministic;
+  char                 err_msg[CEED_MAX_RESOURCE_LEN];
+  FOffset             *f_offsets;
+  CeedWorkVectors      work_vectors;
+  CeedBasisProjections basis_projections;
+  CeedProfile          profile;
+  bool                 is_profile_env_applied; /* Profiling environment variables have been applied to this root Ceed */
 };
 
 struct CeedVector_private {
@@ -187,9 +255,12 @@ struct CeedElemRestriction_private {
   CeedInt  l_layout[3]; /* L-vector layout [nodes, components, elements] */
   CeedInt  e_layout[3]; /* E-vector layout [nodes, components, elements] */
   CeedRestrictionType
-           rstr_type;   /* initialized in element restriction constructor for default, oriented, curl-oriented, or strided element restriction */
-  uint64_t num_readers; /* number of instances of offset read only access */
-  void    *data;        /* place for the backend to store any data */
+           rstr_type;     /* initialized in element restriction constructor for default, oriented, curl-oriented, or strided element restriction */
+  uint64_t num_readers;   /* number of instances of offset read only access */
+  CeedInt  num_colors;    /* number of colors of blocks, if computed */
+  CeedInt *color_offsets; /* start of each color in color_blocks */
+  CeedInt *color_blocks;  /* blocks ordered by color */
+  void    *data;          /* place for the backend to store any data */
 };
 
 struct CeedBasis_private {
@@ -222,6 +293,8 @@ struct CeedBasis_private {
                        quadrature points for H(curl) discretizations */
   CeedVector  vec_chebyshev;
   CeedBasis   basis_chebyshev; /* basis interpolating from nodes to Chebyshev polynomial coefficients */
+  CeedBasis   basis_fdm;       /* basis interpolating from nodes to 1D fast diagonalization eigenvector coefficients */
+  CeedScalar *fdm_lambda_1d;   /* array of length P1d holding the 1D fast diagonalization eigenvalues */
   void       *data;            /* place for the backend to store any data */
 };
 
@@ -281,6 +354,7 @@ struct CeedQFunctionContext_private {
   int (*Destroy)(CeedQFunctionContext);
   CeedQFunctionContextDataDestroyUser data_destroy_function;
   CeedMemType                         data_destroy_mem_type;
+  CeedQFunctionContextDataReduceUser  data_reduce_function;
   CeedInt                             num_fields;
   CeedInt                             max_fields;
   CeedContextFieldLabel              *field_labels;
@@ -339,7 +413,10 @@ struct CeedOperatorAssemblyData_private {
   CeedInt             *num_eval_modes_in, *num_eval_modes_out;
   CeedEvalMode       **eval_modes_in, **eval_modes_out;
   CeedScalar         **assembled_bases_in, **assembled_bases_out;
-  CeedSize           **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
+  CeedSize           **eval_mode_offsets_in, **eval_mode_offsets_out, num_input_components, num_output_components;
+  bool                *qf_is_nonzero;    /* Entries of the assembled CeedQFunction matrix that are nonzero at some quadrature point */
+  bool                 qf_is_symmetric;  /* Assembled CeedQFunction matrix is symmetric at every quadrature point */
+  uint64_t             qf_pattern_state; /* State of assembled CeedQFunction data used to detect the pattern */
 };
 
 struct CeedOperator_private {
@@ -360,6 +437,8 @@ struct CeedOperator_private {
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddElementMatrices)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddFDMElementInverse)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector, CeedVector, CeedRequest *);
   int (*Destroy)(CeedOperator);
   CeedOperatorField        *input_fields;
@@ -372,6 +451,7 @@ struct CeedOperator_private {
   CeedQFunction             dqf;
   CeedQFunction             dqfT;
   const char               *name;
+  double                    apply_time; /* Wall time of the last application, recorded when profiling */
   bool                      is_immutable;
   bool                      is_interface_setup;
   bool                      is_backend_setup;
@@ -380,6 +460,15 @@ struct CeedOperator_private {
   bool                      has_restriction;
   CeedQFunctionAssemblyData qf_assembled;
   CeedOperatorAssemblyData  op_assembled;
+  CeedInt                  *csr_map; /* Compressed sparse row value index for each coordinate entry */
+  CeedSize                  csr_num_entries, csr_num_nonzeros;
+  bool                      reuse_elem_mats;         /* Store element matrices from full assembly for reuse */
+  CeedScalar               *elem_mats;               /* Stored element matrices, in coordinate assembly order */
+  uint64_t                  elem_mats_qf_state;      /* State of assembled QFunction data used for stored element matrices */
+  uint64_t                  elem_mats_passive_state; /* Combined state of passive inputs and context for element matrix application */
+  bool                      allow_elem_mat_apply, is_elem_mat_apply_setup, use_elem_mat_apply;
+  CeedElemRestriction       elem_mat_rstr_in, elem_mat_rstr_out; /* Unoriented active restrictions for element matrix application */
+  bool                      is_fdm_inverse; /* Created by the default CeedOperatorCreateFDMElementInverse() */
   CeedOperator             *sub_operators;
   CeedInt                   num_suboperators;
   void                     *data;
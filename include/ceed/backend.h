@@ -173,6 +173,11 @@ typedef struct CeedQFunctionAssemblyData_private *CeedQFunctionAssemblyData;
 /// @ingroup CeedOperator
 typedef struct CeedOperatorAssemblyData_private *CeedOperatorAssemblyData;
 
+/// Assemble the linearized CeedQFunction for a block of elements, see @ref CeedOperatorLinearAssembleAddDiagonalByBlock()
+/// @ingroup CeedOperator
+typedef int (*CeedOperatorLinearAssembleQFunctionBlock)(CeedOperator op, CeedInt e_start, CeedInt num_elem_block, void *ctx,
+                                                        CeedScalar *assembled_block, CeedRequest *request);
+
 /* In the next 3 functions, p has to be the address of a pointer type, i.e. p has to be a pointer to a pointer. */
 CEED_INTERN int CeedMallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedCallocArray(size_t n, size_t unit, void *p);
@@ -254,6 +259,10 @@ CEED_EXTERN int CeedSetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedReference(Ceed ceed);
 CEED_EXTERN int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec);
 CEED_EXTERN int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec);
+CEED_INTERN int CeedProfileEventBegin(Ceed ceed, const char *event_name, const char *object_name, CeedSize num_scalars, CeedInt *event);
+CEED_INTERN int CeedProfileEventEnd(Ceed ceed, CeedInt event, double *duration);
+CEED_INTERN int CeedProfileThreadsBegin(Ceed ceed, CeedInt num_threads);
+CEED_INTERN int CeedProfileThreadsEnd(Ceed ceed);
 
 CEED_EXTERN int CeedVectorHasValidArray(CeedVector vec, bool *has_valid_array);
 CEED_EXTERN int CeedVectorHasBorrowedArrayOfType(CeedVector vec, CeedMemType mem_type, bool *has_borrowed_array_of_type);
@@ -300,6 +309,9 @@ CEED_EXTERN int CeedElemRestrictionGetData(CeedElemRestriction rstr, void *data)
 CEED_EXTERN int CeedElemRestrictionSetData(CeedElemRestriction rstr, void *data);
 CEED_EXTERN int CeedElemRestrictionReference(CeedElemRestriction rstr);
 CEED_EXTERN int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *flops);
+CEED_EXTERN int CeedElemRestrictionGetMemoryTrafficEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *bytes);
+CEED_EXTERN int CeedElemRestrictionGetColoring(CeedElemRestriction rstr, CeedInt *num_colors, const CeedInt **color_offsets,
+                                               const CeedInt **color_blocks);
 
 /// Type of FE space;
 /// @ingroup CeedBasis
@@ -391,10 +403,14 @@ CEED_EXTERN int  CeedQFunctionContextGetBooleanRead(CeedQFunctionContext ctx, Ce
                                                     const bool **values);
 CEED_EXTERN int  CeedQFunctionContextRestoreBooleanRead(CeedQFunctionContext ctx, CeedContextFieldLabel field_label, const bool **values);
 CEED_EXTERN int  CeedQFunctionContextGetDataDestroy(CeedQFunctionContext ctx, CeedMemType *f_mem_type, CeedQFunctionContextDataDestroyUser *f);
+CEED_EXTERN int  CeedQFunctionContextGetDataReduce(CeedQFunctionContext ctx, CeedQFunctionContextDataReduceUser *f);
 CEED_EXTERN int  CeedQFunctionContextReference(CeedQFunctionContext ctx);
 
 CEED_EXTERN int CeedOperatorGetBasisPointer(CeedBasis basis, CeedEvalMode eval_mode, const CeedScalar *identity, const CeedScalar **basis_ptr);
 CEED_EXTERN int CeedOperatorCreateActivePointBlockRestriction(CeedElemRestriction rstr, CeedElemRestriction *pointblock_rstr);
+CEED_EXTERN int CeedOperatorLinearAssembleAddDiagonalByBlock(CeedOperator op, CeedInt block_size, const CeedInt layout_block[3],
+                                                             CeedOperatorLinearAssembleQFunctionBlock assemble_block, void *ctx, bool is_point_block,
+                                                             CeedVector assembled, CeedRequest *request);
 
 CEED_EXTERN int CeedOperatorGetQFunctionAssemblyData(CeedOperator op, CeedQFunctionAssemblyData *data);
 CEED_EXTERN int CeedQFunctionAssemblyDataCreate(Ceed ceed, CeedQFunctionAssemblyData *data);
@@ -422,6 +438,8 @@ CEED_EXTERN int CeedOperatorAssemblyDataGetElemRestrictions(CeedOperatorAssembly
                                                             CeedElemRestriction **active_elem_rstrs_in, CeedInt *num_active_elem_rstrs_out,
                                                             CeedElemRestriction **active_elem_rstrs_out);
 CEED_EXTERN int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data);
+CEED_EXTERN int CeedOperatorGetElementMatrices(CeedOperator op, CeedElemRestriction *rstr_in, CeedElemRestriction *rstr_out,
+                                               const CeedScalar **elem_mats);
 
 CEED_EXTERN int CeedOperatorGetActiveBasis(CeedOperator op, CeedBasis *active_basis);
 CEED_EXTERN int CeedOperatorGetActiveBases(CeedOperator op, CeedBasis *active_input_basis, CeedBasis *active_output_basis);
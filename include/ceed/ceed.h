@@ -108,6 +108,11 @@ CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *is_deterministic);
 CEED_EXTERN int CeedAddJitSourceRoot(Ceed ceed, const char *jit_source_root);
 CEED_EXTERN int CeedView(Ceed ceed, FILE *stream);
+CEED_EXTERN int CeedSetProfiling(Ceed ceed, bool is_profiling);
+CEED_EXTERN int CeedIsProfiling(Ceed ceed, bool *is_profiling);
+CEED_EXTERN int CeedSetProfilingTraceFile(Ceed ceed, const char *file_name);
+CEED_EXTERN int CeedSetProfilingCounters(Ceed ceed, bool use_counters);
+CEED_EXTERN int CeedProfilingView(Ceed ceed, FILE *stream);
 CEED_EXTERN int CeedDestroy(Ceed *ceed);
 CEED_EXTERN int CeedErrorImpl(Ceed ceed, const char *filename, int lineno, const char *func, int ecode, const char *format, ...);
 
@@ -380,6 +385,18 @@ CEED_EXTERN int CeedQFunctionFieldGetData(CeedQFunctionField qf_field, const cha
 **/
 typedef int (*CeedQFunctionContextDataDestroyUser)(void *data);
 
+/** Handle for the user provided @ref CeedQFunctionContextSetDataReduce() callback function
+
+ @param[in,out] data         User `CeedQFunctionContext` data
+ @param[in]     thread_data  Private copy of the user data after use by a single thread
+ @param[in]     initial_data User data before the `CeedQFunction` application, as given to each thread
+
+ @return An error code: 0 - success, otherwise - failure
+
+ @ingroup CeedQFunction
+**/
+typedef int (*CeedQFunctionContextDataReduceUser)(void *data, const void *thread_data, const void *initial_data);
+
 CEED_EXTERN int CeedQFunctionContextCreate(Ceed ceed, CeedQFunctionContext *ctx);
 CEED_EXTERN int CeedQFunctionContextReferenceCopy(CeedQFunctionContext ctx, CeedQFunctionContext *ctx_copy);
 CEED_EXTERN int CeedQFunctionContextSetData(CeedQFunctionContext ctx, CeedMemType mem_type, CeedCopyMode copy_mode, size_t size, void *data);
@@ -400,6 +417,7 @@ CEED_EXTERN int CeedContextFieldLabelGetDescription(CeedContextFieldLabel label,
 CEED_EXTERN int CeedQFunctionContextGetContextSize(CeedQFunctionContext ctx, size_t *ctx_size);
 CEED_EXTERN int CeedQFunctionContextView(CeedQFunctionContext ctx, FILE *stream);
 CEED_EXTERN int CeedQFunctionContextSetDataDestroy(CeedQFunctionContext ctx, CeedMemType f_mem_type, CeedQFunctionContextDataDestroyUser f);
+CEED_EXTERN int CeedQFunctionContextSetDataReduce(CeedQFunctionContext ctx, CeedQFunctionContextDataReduceUser f);
 CEED_EXTERN int CeedQFunctionContextDestroy(CeedQFunctionContext *ctx);
 
 CEED_EXTERN int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, CeedQFunction dqfT, CeedOperator *op);
@@ -420,6 +438,8 @@ CEED_EXTERN int  CeedOperatorCheckReady(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetActiveVectorLengths(CeedOperator op, CeedSize *input_size, CeedSize *output_size);
 CEED_EXTERN int  CeedOperatorSetQFunctionAssemblyReuse(CeedOperator op, bool reuse_assembly_data);
 CEED_EXTERN int  CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(CeedOperator op, bool needs_data_update);
+CEED_EXTERN int  CeedOperatorSetElementMatrixReuse(CeedOperator op, bool reuse_elem_mats);
+CEED_EXTERN int  CeedOperatorSetElementMatrixApply(CeedOperator op, bool allow_elem_mat_apply);
 CEED_EXTERN int  CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr,
                                                                   CeedRequest *request);
@@ -429,7 +449,10 @@ CEED_EXTERN int  CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, C
 CEED_EXTERN int  CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorLinearAssemblePointBlockDiagonalSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
 CEED_EXTERN int  CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols);
+CEED_EXTERN int  CeedOperatorLinearAssembleSymbolic64(CeedOperator op, CeedSize *num_entries, CeedSize **rows, CeedSize **cols);
 CEED_EXTERN int  CeedOperatorLinearAssemble(CeedOperator op, CeedVector values);
+CEED_EXTERN int  CeedOperatorLinearAssembleSymbolicCSR(CeedOperator op, CeedSize *num_nonzeros, CeedInt **row_ptr, CeedInt **col_idx);
+CEED_EXTERN int  CeedOperatorLinearAssembleCSR(CeedOperator op, CeedVector values);
 CEED_EXTERN int  CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indices, CeedInt *skip_indices, CeedVector mult);
 CEED_EXTERN int  CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
                                                   CeedBasis basis_coarse, CeedOperator *op_coarse, CeedOperator *op_prolong,
@@ -440,6 +463,9 @@ CEED_EXTERN int  CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine,
 CEED_EXTERN int  CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
                                                     CeedBasis basis_coarse, const CeedScalar *interp_c_to_f, CeedOperator *op_coarse,
                                                     CeedOperator *op_prolong, CeedOperator *op_restrict);
+CEED_EXTERN int  CeedOperatorMultigridHierarchyCreate(CeedOperator op_fine, CeedInt num_levels, CeedVector *p_mult, CeedElemRestriction *rstr_coarse,
+                                                      CeedBasis *basis_coarse, CeedOperator *op_coarse, CeedOperator *op_prolong,
+                                                      CeedOperator *op_restrict);
 CEED_EXTERN int  CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request);
 CEED_EXTERN int  CeedOperatorSetName(CeedOperator op, const char *name);
 CEED_EXTERN int  CeedOperatorView(CeedOperator op, FILE *stream);
@@ -449,6 +475,7 @@ CEED_EXTERN Ceed CeedOperatorReturnCeed(CeedOperator op);
 CEED_EXTERN int  CeedOperatorGetNumElements(CeedOperator op, CeedInt *num_elem);
 CEED_EXTERN int  CeedOperatorGetNumQuadraturePoints(CeedOperator op, CeedInt *num_qpts);
 CEED_EXTERN int  CeedOperatorGetFlopsEstimate(CeedOperator op, CeedSize *flops);
+CEED_EXTERN int  CeedOperatorGetMemoryTrafficEstimate(CeedOperator op, CeedSize *bytes);
 CEED_EXTERN int  CeedOperatorGetContext(CeedOperator op, CeedQFunctionContext *ctx);
 CEED_EXTERN int  CeedOperatorGetContextFieldLabel(CeedOperator op, const char *field_name, CeedContextFieldLabel *field_label);
 CEED_EXTERN int  CeedOperatorSetContextDouble(CeedOperator op, CeedContextFieldLabel field_label, double *values);
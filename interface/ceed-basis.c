@@ -176,11 +176,125 @@ static int CeedScalarView(const char *name, const char *fp_fmt, CeedInt m, CeedI
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Hash the source matrices and sizes for a `CeedBasis` projection with 64 bit FNV-1a
+
+  @param[in]  header   Integer sizes describing the projection
+  @param[in]  key_size Number of entries in `key`
+  @param[in]  key      Packed source matrices for the projection
+  @param[out] hash     Hash of `header` and `key`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisProjectionHash(const CeedInt header[7], CeedSize key_size, const CeedScalar *key, uint64_t *hash) {
+  const unsigned char *bytes[2]     = {(const unsigned char *)header, (const unsigned char *)key};
+  const size_t         num_bytes[2] = {7 * sizeof(header[0]), key_size * sizeof(key[0])};
+
+  *hash = 14695981039346656037ULL;
+  for (CeedInt k = 0; k < 2; k++) {
+    for (size_t i = 0; i < num_bytes[k]; i++) *hash = (*hash ^ bytes[k][i]) * 1099511628211ULL;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Find projection matrices computed from identical source matrices in the projection cache of a `Ceed`
+
+  A match is moved to the most recently used position of the cache.
+
+  @param[in]  ceed       `Ceed` holding the projection cache
+  @param[in]  header     Integer sizes describing the projection
+  @param[in]  key_size   Number of entries in `key`
+  @param[in]  key        Packed source matrices for the projection
+  @param[in]  hash       Hash of `header` and `key`
+  @param[out] projection Cached projection, or `NULL` if no match was found
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisProjectionFind(Ceed ceed, const CeedInt header[7], CeedSize key_size, const CeedScalar *key, uint64_t hash,
+                                   CeedBasisProjection **projection) {
+  *projection = NULL;
+  if (!ceed->basis_projections) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < ceed->basis_projections->num_projections; i++) {
+    CeedBasisProjection *cached = &ceed->basis_projections->projections[i];
+
+    if (cached->hash != hash || cached->key_size != key_size) continue;
+    if (memcmp(cached->header, header, sizeof(cached->header)) || memcmp(cached->key, key, key_size * sizeof(key[0]))) continue;
+    {
+      const CeedInt       last = ceed->basis_projections->num_projections - 1;
+      CeedBasisProjection match = *cached;
+
+      memmove(cached, cached + 1, (last - i) * sizeof(*cached));
+      ceed->basis_projections->projections[last] = match;
+      *projection                                = &ceed->basis_projections->projections[last];
+    }
+    return CEED_ERROR_SUCCESS;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add projection matrices to the projection cache of a `Ceed`
+
+  The cache holds at most `CEED_BASIS_PROJECTION_CACHE_SIZE` projections, and the least recently used projection is evicted when it is full.
+
+  @param[in,out] ceed           `Ceed` holding the projection cache
+  @param[in]     header         Integer sizes describing the projection
+  @param[in]     key_size       Number of entries in `key`
+  @param[in]     key            Packed source matrices for the projection, ownership is transferred to the cache
+  @param[in]     hash           Hash of `header` and `key`
+  @param[in]     interp_size    Number of entries in `interp_project`
+  @param[in]     interp_project Projection interpolation matrix to copy
+  @param[in]     grad_size      Number of entries in `grad_project`
+  @param[in]     grad_project   Projection gradient matrix to copy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisProjectionAdd(Ceed ceed, const CeedInt header[7], CeedSize key_size, CeedScalar *key, uint64_t hash, CeedSize interp_size,
+                                  const CeedScalar *interp_project, CeedSize grad_size, const CeedScalar *grad_project) {
+  CeedBasisProjections projections;
+  CeedBasisProjection *projection;
+
+  if (!ceed->basis_projections) {
+    CeedCall(CeedCalloc(1, &ceed->basis_projections));
+    CeedCall(CeedCalloc(CEED_BASIS_PROJECTION_CACHE_SIZE, &ceed->basis_projections->projections));
+  }
+  projections = ceed->basis_projections;
+  if (projections->num_projections == CEED_BASIS_PROJECTION_CACHE_SIZE) {
+    // Evict least recently used projection
+    CeedCall(CeedFree(&projections->projections[0].key));
+    CeedCall(CeedFree(&projections->projections[0].interp_project));
+    CeedCall(CeedFree(&projections->projections[0].grad_project));
+    memmove(projections->projections, projections->projections + 1, (CEED_BASIS_PROJECTION_CACHE_SIZE - 1) * sizeof(projections->projections[0]));
+    projections->num_projections--;
+  }
+  projection = &projections->projections[projections->num_projections++];
+  memcpy(projection->header, header, sizeof(projection->header));
+  projection->hash        = hash;
+  projection->key_size    = key_size;
+  projection->key         = key;
+  projection->interp_size = interp_size;
+  projection->grad_size   = grad_size;
+  CeedCall(CeedMalloc(interp_size, &projection->interp_project));
+  memcpy(projection->interp_project, interp_project, interp_size * sizeof(interp_project[0]));
+  CeedCall(CeedMalloc(grad_size, &projection->grad_project));
+  memcpy(projection->grad_project, grad_project, grad_size * sizeof(grad_project[0]));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create the interpolation and gradient matrices for projection from the nodes of `basis_from` to the nodes of `basis_to`.
 
   The interpolation is given by `interp_project = interp_to^+ * interp_from`, where the pseudoinverse `interp_to^+` is given by QR factorization.
   The gradient is given by `grad_project = interp_to^+ * grad_from`, and is only computed for \f$H^1\f$ spaces otherwise it should not be used.
+  The matrices are cached on the parent `Ceed`, keyed on the source matrices, so repeated projections between the same spaces skip the factorization.
+  The cache keeps the `CEED_BASIS_PROJECTION_CACHE_SIZE` most recently used projections and is freed with the parent `Ceed`.
 
   Note: `basis_from` and `basis_to` must have compatible quadrature spaces.
 
@@ -265,11 +379,35 @@ static int CeedBasisCreateProjectionMatrices(CeedBasis basis_from, CeedBasis bas
   }
   CeedCall(CeedCalloc(P_to * P_from * (are_both_tensor ? 1 : dim), grad_project));
 
+  // Reuse projection matrices computed from identical source matrices, if available
+  Ceed                 ceed_parent;
+  uint64_t             hash;
+  CeedInt              num_matrices = 1 + (fe_space_to == CEED_FE_SPACE_H1) * (are_both_tensor ? 1 : dim);
+  CeedInt              header[7]    = {are_both_tensor, fe_space_to, dim, Q, q_comp, P_to, P_from};
+  CeedSize             interp_size  = P_to * P_from, grad_size = P_to * P_from * (are_both_tensor ? 1 : dim);
+  CeedSize             key_size     = Q * q_comp * P_to + Q * P_from * q_comp + (num_matrices - 1) * Q * P_from;
+  CeedScalar          *key;
+  CeedBasisProjection *cached;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  CeedCall(CeedMalloc(key_size, &key));
+  memcpy(key, interp_to_source, Q * q_comp * P_to * sizeof(key[0]));
+  memcpy(&key[Q * q_comp * P_to], interp_from_source, Q * P_from * q_comp * sizeof(key[0]));
+  if (num_matrices > 1) memcpy(&key[Q * q_comp * (P_to + P_from)], grad_from_source, (num_matrices - 1) * Q * P_from * sizeof(key[0]));
+  CeedCall(CeedBasisProjectionHash(header, key_size, key, &hash));
+  CeedCall(CeedBasisProjectionFind(ceed_parent, header, key_size, key, hash, &cached));
+  if (cached) {
+    memcpy(*interp_project, cached->interp_project, interp_size * sizeof(cached->interp_project[0]));
+    memcpy(*grad_project, cached->grad_project, grad_size * sizeof(cached->grad_project[0]));
+    CeedCall(CeedFree(&key));
+    CeedCall(CeedFree(&interp_from));
+    return CEED_ERROR_SUCCESS;
+  }
+
   // Compute interp_to^+, pseudoinverse of interp_to
   CeedCall(CeedCalloc(Q * q_comp * P_to, &interp_to_inv));
   CeedCall(CeedMatrixPseudoinverse(ceed, interp_to_source, Q * q_comp, P_to, interp_to_inv));
   // Build matrices
-  CeedInt     num_matrices = 1 + (fe_space_to == CEED_FE_SPACE_H1) * (are_both_tensor ? 1 : dim);
   CeedScalar *input_from[num_matrices], *output_project[num_matrices];
 
   input_from[0]     = (CeedScalar *)interp_from_source;
@@ -288,6 +426,9 @@ static int CeedBasisCreateProjectionMatrices(CeedBasis basis_from, CeedBasis bas
     }
   }
 
+  // Store for later projections between the same spaces
+  CeedCall(CeedBasisProjectionAdd(ceed_parent, header, key_size, key, hash, interp_size, *interp_project, grad_size, *grad_project));
+
   // Cleanup
   CeedCall(CeedFree(&interp_to_inv));
   CeedCall(CeedFree(&interp_from));
@@ -1632,6 +1773,8 @@ int CeedBasisCreateHcurl(Ceed ceed, CeedElemTopology topo, CeedInt num_comp, Cee
 
   Note: If either `basis_from` or `basis_to` are non-tensor, then `basis_project` will also be non-tensor
 
+  Note: The projection matrices for the most recently used pairs of spaces are cached on the parent `Ceed` until it is destroyed.
+
   @param[in]  basis_from    `CeedBasis` to prolong from
   @param[in]  basis_to      `CeedBasis` to prolong to
   @param[out] basis_project Address of the variable where the newly created `CeedBasis` will be stored
@@ -1838,6 +1981,38 @@ static int CeedBasisApplyCheckDims(CeedBasis basis, CeedInt num_elem, CeedTransp
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Start recording a profiling event for a `CeedBasis` application
+
+  @param[in]  basis      `CeedBasis` being applied
+  @param[in]  event_name Name of the interface function
+  @param[in]  num_elem   The number of elements the basis evaluation is applied to
+  @param[in]  eval_mode  Evaluation mode
+  @param[out] event      Handle to pass to `CeedProfileEventEnd()`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisProfileEventBegin(CeedBasis basis, const char *event_name, CeedInt num_elem, CeedEvalMode eval_mode, CeedInt *event) {
+  bool     is_profiling;
+  CeedSize num_scalars = 0;
+
+  CeedCall(CeedIsProfiling(basis->ceed, &is_profiling));
+  if (is_profiling) {
+    CeedInt num_comp, q_comp, num_nodes, num_qpts;
+
+    CeedCall(CeedBasisGetNumComponents(basis, &num_comp));
+    CeedCall(CeedBasisGetNumQuadratureComponents(basis, eval_mode, &q_comp));
+    CeedCall(CeedBasisGetNumNodes(basis, &num_nodes));
+    CeedCall(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+    if (eval_mode == CEED_EVAL_WEIGHT) num_scalars = (CeedSize)num_elem * (CeedSize)num_qpts;
+    else num_scalars = (CeedSize)num_elem * (CeedSize)num_comp * ((CeedSize)num_nodes + (CeedSize)num_qpts * (CeedSize)q_comp);
+  }
+  CeedCall(CeedProfileEventBegin(basis->ceed, event_name, NULL, num_scalars, event));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Apply basis evaluation from nodes to quadrature points or vice versa
 
@@ -1860,9 +2035,13 @@ static int CeedBasisApplyCheckDims(CeedBasis basis, CeedInt num_elem, CeedTransp
   @ref User
 **/
 int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v) {
+  CeedInt event;
+
   CeedCall(CeedBasisApplyCheckDims(basis, num_elem, t_mode, eval_mode, u, v));
   CeedCheck(basis->Apply, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not support CeedBasisApply");
+  CeedCall(CeedBasisProfileEventBegin(basis, "CeedBasisApply", num_elem, eval_mode, &event));
   CeedCall(basis->Apply(basis, num_elem, t_mode, eval_mode, u, v));
+  CeedCall(CeedProfileEventEnd(basis->ceed, event, NULL));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1888,10 +2067,14 @@ int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode,
   @ref User
 **/
 int CeedBasisApplyAdd(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector u, CeedVector v) {
+  CeedInt event;
+
   CeedCheck(t_mode == CEED_TRANSPOSE, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "CeedBasisApplyAdd only supports CEED_TRANSPOSE");
   CeedCall(CeedBasisApplyCheckDims(basis, num_elem, t_mode, eval_mode, u, v));
   CeedCheck(basis->ApplyAdd, CeedBasisReturnCeed(basis), CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedBasisApplyAdd");
+  CeedCall(CeedBasisProfileEventBegin(basis, "CeedBasisApplyAdd", num_elem, eval_mode, &event));
   CeedCall(basis->ApplyAdd(basis, num_elem, t_mode, eval_mode, u, v));
+  CeedCall(CeedProfileEventEnd(basis->ceed, event, NULL));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2286,6 +2469,8 @@ int CeedBasisDestroy(CeedBasis *basis) {
   CeedCall(CeedFree(&(*basis)->curl));
   CeedCall(CeedVectorDestroy(&(*basis)->vec_chebyshev));
   CeedCall(CeedBasisDestroy(&(*basis)->basis_chebyshev));
+  CeedCall(CeedBasisDestroy(&(*basis)->basis_fdm));
+  CeedCall(CeedFree(&(*basis)->fdm_lambda_1d));
   CeedCall(CeedDestroy(&(*basis)->ceed));
   CeedCall(CeedFree(basis));
   return CEED_ERROR_SUCCESS;
@@ -588,6 +588,128 @@ int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeM
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Estimate number of bytes read and written to apply `CeedElemRestriction` in `t_mode`
+
+  The estimate counts the L-vector, read in @ref CEED_NOTRANSPOSE and read and written in @ref CEED_TRANSPOSE, the E-vector, and the offsets and orientations, if any.
+
+  @param[in]  rstr   `CeedElemRestriction` to estimate memory traffic for
+  @param[in]  t_mode Apply restriction or transpose
+  @param[out] bytes  Address of variable to hold memory traffic estimate
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetMemoryTrafficEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *bytes) {
+  CeedInt             num_elem, num_comp;
+  CeedSize            l_size, e_size, num_nodes;
+  CeedRestrictionType rstr_type;
+
+  CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
+  CeedCall(CeedElemRestrictionGetEVectorSize(rstr, &e_size));
+  CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+  *bytes    = (e_size + (t_mode == CEED_TRANSPOSE ? 2 : 1) * l_size) * (CeedSize)sizeof(CeedScalar);
+  num_nodes = e_size / num_comp;
+  switch (rstr_type) {
+    case CEED_RESTRICTION_STRIDED:
+      break;
+    case CEED_RESTRICTION_STANDARD:
+      *bytes += num_nodes * (CeedSize)sizeof(CeedInt);
+      break;
+    case CEED_RESTRICTION_ORIENTED:
+      *bytes += num_nodes * (CeedSize)(sizeof(CeedInt) + sizeof(bool));
+      break;
+    case CEED_RESTRICTION_CURL_ORIENTED:
+      *bytes += num_nodes * (CeedSize)(sizeof(CeedInt) + 3 * sizeof(CeedInt8));
+      break;
+    case CEED_RESTRICTION_POINTS:
+      *bytes += (num_elem + 1 + num_nodes) * (CeedSize)sizeof(CeedInt);
+      break;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get a coloring of the element blocks of a `CeedElemRestriction`
+
+  Blocks of the same color touch disjoint L-vector entries, so the transpose restriction of all blocks in one color may be applied concurrently.
+  The coloring is computed greedily on first use and cached with the `CeedElemRestriction`.
+  Blocks of color `c` are `color_blocks[color_offsets[c]]` through `color_blocks[color_offsets[c + 1] - 1]`.
+
+  @param[in]  rstr          `CeedElemRestriction` to color
+  @param[out] num_colors    Variable to store number of colors
+  @param[out] color_offsets Variable to store array of size `num_colors + 1` with the start of each color in `color_blocks`
+  @param[out] color_blocks  Variable to store array of size `num_block` with the block indices, ordered by color
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetColoring(CeedElemRestriction rstr, CeedInt *num_colors, const CeedInt **color_offsets, const CeedInt **color_blocks) {
+  if (!rstr->color_offsets) {
+    CeedInt             num_block, block_size, elem_size, num_colored = 0, num_colors_new = 0;
+    CeedInt            *block_colors, *color_sizes, *color_offsets_new, *color_blocks_new;
+    CeedRestrictionType rstr_type;
+
+    CeedCall(CeedElemRestrictionGetType(rstr, &rstr_type));
+    CeedCheck(rstr_type != CEED_RESTRICTION_POINTS, CeedElemRestrictionReturnCeed(rstr), CEED_ERROR_UNSUPPORTED,
+              "Coloring not supported for CeedElemRestriction at points");
+    CeedCall(CeedElemRestrictionGetNumBlocks(rstr, &num_block));
+    CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+    CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+    CeedCall(CeedCalloc(num_block, &block_colors));
+    if (rstr_type == CEED_RESTRICTION_STRIDED) {
+      // Strided elements never share L-vector entries
+      num_colors_new = num_block > 0;
+    } else {
+      const CeedInt  block_len = block_size * elem_size;
+      CeedInt        max_offset = -1, *node_colors;
+      const CeedInt *offsets;
+
+      CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+      for (CeedSize i = 0; i < (CeedSize)num_block * block_len; i++) max_offset = CeedIntMax(max_offset, offsets[i]);
+      CeedCall(CeedMalloc(max_offset + 1, &node_colors));
+      for (CeedInt i = 0; i <= max_offset; i++) node_colors[i] = -1;
+      for (CeedInt b = 0; b < num_block; b++) block_colors[b] = -1;
+
+      // Each pass gives the next color to every remaining block that shares no node with a block already given that color
+      while (num_colored < num_block) {
+        for (CeedInt b = 0; b < num_block; b++) {
+          bool           is_free       = block_colors[b] == -1;
+          const CeedInt *block_offsets = &offsets[(CeedSize)b * block_len];
+
+          for (CeedInt i = 0; is_free && i < block_len; i++) is_free = node_colors[block_offsets[i]] != num_colors_new;
+          if (!is_free) continue;
+          for (CeedInt i = 0; i < block_len; i++) node_colors[block_offsets[i]] = num_colors_new;
+          block_colors[b] = num_colors_new;
+          num_colored++;
+        }
+        num_colors_new++;
+      }
+      CeedCall(CeedFree(&node_colors));
+      CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+    }
+
+    // Sort blocks by color
+    CeedCall(CeedCalloc(num_colors_new + 1, &color_offsets_new));
+    CeedCall(CeedCalloc(num_colors_new, &color_sizes));
+    CeedCall(CeedCalloc(num_block, &color_blocks_new));
+    for (CeedInt b = 0; b < num_block; b++) color_offsets_new[block_colors[b] + 1]++;
+    for (CeedInt c = 0; c < num_colors_new; c++) color_offsets_new[c + 1] += color_offsets_new[c];
+    for (CeedInt b = 0; b < num_block; b++) color_blocks_new[color_offsets_new[block_colors[b]] + color_sizes[block_colors[b]]++] = b;
+    CeedCall(CeedFree(&block_colors));
+    CeedCall(CeedFree(&color_sizes));
+    rstr->num_colors    = num_colors_new;
+    rstr->color_offsets = color_offsets_new;
+    rstr->color_blocks  = color_blocks_new;
+  }
+  *num_colors    = rstr->num_colors;
+  *color_offsets = rstr->color_offsets;
+  *color_blocks  = rstr->color_blocks;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// @cond DOXYGEN_SKIP
@@ -1308,7 +1430,14 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
             "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", len, min_u_len,
             min_ru_len);
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
-  if (num_elem > 0) CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+  if (num_elem > 0) {
+    CeedInt event;
+
+    CeedCall(CeedProfileEventBegin(ceed, t_mode == CEED_TRANSPOSE ? "CeedElemRestrictionApply (transpose)" : "CeedElemRestrictionApply", NULL,
+                                   min_u_len + min_ru_len, &event));
+    CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+    CeedCall(CeedProfileEventEnd(ceed, event, NULL));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1386,7 +1515,7 @@ int CeedElemRestrictionApplyAtPointsInElement(CeedElemRestriction rstr, CeedInt
 int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector ru,
                                   CeedRequest *request) {
   CeedSize min_u_len, min_ru_len, len;
-  CeedInt  block_size, num_elem;
+  CeedInt  block_size, num_elem, event;
   Ceed     ceed;
 
   CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
@@ -1420,7 +1549,10 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedT
   CeedCheck(block_size * block <= num_elem, ceed, CEED_ERROR_DIMENSION,
             "Cannot retrieve block %" CeedInt_FMT ", element %" CeedInt_FMT " > total elements %" CeedInt_FMT "", block, block_size * block,
             num_elem);
+  CeedCall(CeedProfileEventBegin(ceed, t_mode == CEED_TRANSPOSE ? "CeedElemRestrictionApplyBlock (transpose)" : "CeedElemRestrictionApplyBlock", NULL,
+                                 2 * (t_mode == CEED_NOTRANSPOSE ? min_ru_len : min_u_len), &event));
   CeedCall(rstr->ApplyBlock(rstr, block, t_mode, u, ru, request));
+  CeedCall(CeedProfileEventEnd(ceed, event, NULL));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1709,6 +1841,13 @@ int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream) {
             " nodes each and %s %s\n",
             rstr->block_size > 1 ? "Blocked " : "", rstr->l_size, rstr->num_comp, rstr->num_elem, rstr->elem_size,
             rstr->strides ? "strides" : "component stride", strides_str);
+    if (rstr->color_offsets) {
+      fprintf(stream, "  %" CeedInt_FMT " color%s with", rstr->num_colors, rstr->num_colors == 1 ? "" : "s");
+      for (CeedInt c = 0; c < rstr->num_colors; c++) {
+        fprintf(stream, "%s %" CeedInt_FMT, c > 0 ? "," : "", rstr->color_offsets[c + 1] - rstr->color_offsets[c]);
+      }
+      fprintf(stream, " %s\n", rstr->block_size > 1 ? "blocks" : "elements");
+    }
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -1735,6 +1874,8 @@ int CeedElemRestrictionDestroy(CeedElemRestriction *rstr) {
   else if ((*rstr)->Destroy) CeedCall((*rstr)->Destroy(*rstr));
 
   CeedCall(CeedFree(&(*rstr)->strides));
+  CeedCall(CeedFree(&(*rstr)->color_offsets));
+  CeedCall(CeedFree(&(*rstr)->color_blocks));
   CeedCall(CeedDestroy(&(*rstr)->ceed));
   CeedCall(CeedFree(rstr));
   return CEED_ERROR_SUCCESS;
@@ -528,6 +528,151 @@ static int CeedOperatorContextRestoreGenericRead(CeedOperator op, CeedContextFie
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Start recording a profiling event for a `CeedOperator` application
+
+  @param[in]  op         `CeedOperator` being applied
+  @param[in]  event_name Name of the interface function
+  @param[in]  in         Input `CeedVector` or @ref CEED_VECTOR_NONE
+  @param[in]  out        Output `CeedVector` or @ref CEED_VECTOR_NONE
+  @param[out] event      Handle to pass to `CeedProfileEventEnd()`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorProfileEventBegin(CeedOperator op, const char *event_name, CeedVector in, CeedVector out, CeedInt *event) {
+  bool     is_profiling;
+  CeedSize num_scalars = 0;
+
+  CeedCall(CeedIsProfiling(op->ceed, &is_profiling));
+  if (is_profiling) {
+    CeedSize length;
+
+    if (in != CEED_VECTOR_NONE) {
+      CeedCall(CeedVectorGetLength(in, &length));
+      num_scalars += length;
+    }
+    if (out != CEED_VECTOR_NONE) {
+      CeedCall(CeedVectorGetLength(out, &length));
+      num_scalars += length;
+    }
+  }
+  CeedCall(CeedProfileEventBegin(op->ceed, event_name, op->name, num_scalars, event));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Estimate number of bytes read and written for one field of a non-composite `CeedOperator`
+
+  @param[in]  op_field   `CeedOperatorField` to estimate memory traffic for
+  @param[in]  qf_field   Matching `CeedQFunctionField`
+  @param[in]  num_points Total number of quadrature points over all elements
+  @param[in]  is_input   Boolean flag for input field
+  @param[out] bytes      Address of variable to hold memory traffic estimate
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorFieldGetMemoryTrafficEstimate(CeedOperatorField op_field, CeedQFunctionField qf_field, CeedSize num_points, bool is_input,
+                                                     CeedSize *bytes) {
+  CeedInt             size;
+  CeedSize            q_bytes;
+  CeedEvalMode        eval_mode;
+  CeedElemRestriction rstr;
+
+  CeedCall(CeedQFunctionFieldGetSize(qf_field, &size));
+  CeedCall(CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode));
+  q_bytes = num_points * size * (CeedSize)sizeof(CeedScalar);
+
+  // Q-vector read or written by the CeedQFunction
+  *bytes = q_bytes;
+  // L-vector, offsets, and E-vector for the CeedElemRestriction, and E-vector for the CeedBasis
+  CeedCall(CeedOperatorFieldGetElemRestriction(op_field, &rstr));
+  if (rstr != CEED_ELEMRESTRICTION_NONE) {
+    CeedSize rstr_bytes;
+
+    CeedCall(CeedElemRestrictionGetMemoryTrafficEstimate(rstr, is_input ? CEED_NOTRANSPOSE : CEED_TRANSPOSE, &rstr_bytes));
+    *bytes += rstr_bytes;
+    if (eval_mode != CEED_EVAL_NONE) {
+      CeedSize e_size;
+
+      CeedCall(CeedElemRestrictionGetEVectorSize(rstr, &e_size));
+      *bytes += e_size * (CeedSize)sizeof(CeedScalar);
+    }
+  }
+  CeedCall(CeedElemRestrictionDestroy(&rstr));
+  // Q-vector for the CeedBasis
+  if (eval_mode != CEED_EVAL_NONE) *bytes += q_bytes;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View the measured performance of the last application of a `CeedOperator`, if any
+
+  @param[in] op     `CeedOperator` to view
+  @param[in] sub    Boolean flag for sub-operator
+  @param[in] stream Stream to write; typically `stdout` or a file
+
+  @return Error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorPerformanceView(CeedOperator op, bool sub, FILE *stream) {
+  const char *pre = sub ? "  " : "";
+  bool        has_flops = true, is_composite;
+  CeedSize    bytes, flops;
+
+  if (op->apply_time <= 0.0) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedOperatorGetMemoryTrafficEstimate(op, &bytes));
+
+  // FLOPs are only available if every CeedQFunction has an estimate
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  for (CeedInt i = 0; i < (is_composite ? op->num_suboperators : 1); i++) {
+    CeedSize qf_flops;
+
+    CeedCall(CeedQFunctionGetFlopsEstimate(is_composite ? op->sub_operators[i]->qf : op->qf, &qf_flops));
+    has_flops = has_flops && qf_flops > -1;
+  }
+  if (has_flops) CeedCall(CeedOperatorGetFlopsEstimate(op, &flops));
+
+  fprintf(stream, "%s  Last application: %.3e s\n", pre, op->apply_time);
+  fprintf(stream, "%s    Memory traffic estimate: %" CeedSize_FMT " bytes, %.3f GB/s\n", pre, bytes, 1e-9 * bytes / op->apply_time);
+  if (has_flops) {
+    fprintf(stream, "%s    FLOPs estimate: %" CeedSize_FMT ", %.3f GFLOP/s\n", pre, flops, 1e-9 * flops / op->apply_time);
+    fprintf(stream, "%s    Arithmetic intensity: %.3f FLOPs/byte\n", pre, bytes > 0 ? (double)flops / bytes : 0.0);
+  }
+  if (!is_composite) {
+    char counters_pre[8];
+
+    snprintf(counters_pre, sizeof(counters_pre), "%s    ", pre);
+    CeedCall(CeedProfileCountersView(op->ceed, op->name, counters_pre, stream));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Determine if any sub-operator of a composite `CeedOperator` is applied with stored element matrices or as an FDM element inverse.
+
+  Backend composite application does not use these paths, so such composite `CeedOperator` apply each sub-operator in turn.
+
+  @param[in]  op              Composite `CeedOperator` to check
+  @param[out] has_fused_apply Variable to store result
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedCompositeOperatorHasFusedApply(CeedOperator op, bool *has_fused_apply) {
+  *has_fused_apply = false;
+  for (CeedInt i = 0; i < op->num_suboperators && !*has_fused_apply; i++) {
+    CeedCall(CeedOperatorIsElementMatrixApply(op->sub_operators[i], has_fused_apply));
+    if (!*has_fused_apply) CeedCall(CeedOperatorIsFDMElementInverseApply(op->sub_operators[i], has_fused_apply));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1481,6 +1626,69 @@ int CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(CeedOperator op, bool needs
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set reuse of element matrices in `CeedOperatorLinearAssemble()` and `CeedOperatorLinearAssembleCSR()`.
+
+  When `reuse_elem_mats = true`, the element matrices computed by the default full assembly are stored with the `CeedOperator`.
+  Later full assemblies copy the stored element matrices instead of recomputing them, as long as the assembled `CeedQFunction` data has not changed.
+  This is most useful with @ref CeedOperatorSetQFunctionAssemblyReuse(), as the `CeedQFunction` data is otherwise re-assembled for every call.
+  The stored element matrices require as much memory as the coordinate values from @ref CeedOperatorLinearAssemble().
+
+  @param[in] op              `CeedOperator`
+  @param[in] reuse_elem_mats Boolean flag setting element matrix reuse
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetElementMatrixReuse(CeedOperator op, bool reuse_elem_mats) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) {
+      CeedCall(CeedOperatorSetElementMatrixReuse(op->sub_operators[i], reuse_elem_mats));
+    }
+  } else {
+    op->reuse_elem_mats = reuse_elem_mats;
+    if (!reuse_elem_mats) CeedCall(CeedFree(&op->elem_mats));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Allow application of a linear `CeedOperator` with stored element matrices.
+
+  When `allow_elem_mat_apply = true`, @ref CeedOperatorApply() and @ref CeedOperatorApplyAdd() restrict the active input, multiply by dense element matrices, and apply the transpose restriction, if the backend supports it and the element matrix products need fewer flops than @ref CeedOperatorGetFlopsEstimate().
+  This is generally faster for low order elements.
+  The element matrices are assembled as in @ref CeedOperatorLinearAssemble(), so the `CeedOperator` must be linear in the active input.
+
+  The element matrices are stored with the `CeedOperator` and re-assembled when a passive input `CeedVector` or the `CeedQFunctionContext` data has been written since the last assembly.
+  Other changes that affect the `CeedQFunction` output, such as data read through pointers in the context, require a call to @ref CeedOperatorSetQFunctionAssemblyDataUpdateNeeded().
+  The `CeedQFunction` assembly reuse setting from @ref CeedOperatorSetQFunctionAssemblyReuse() is not changed.
+
+  @param[in] op                   `CeedOperator`
+  @param[in] allow_elem_mat_apply Boolean flag allowing element matrix application
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetElementMatrixApply(CeedOperator op, bool allow_elem_mat_apply) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) {
+      CeedCall(CeedOperatorSetElementMatrixApply(op->sub_operators[i], allow_elem_mat_apply));
+    }
+  } else {
+    op->allow_elem_mat_apply    = allow_elem_mat_apply;
+    op->is_elem_mat_apply_setup = false;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set name of `CeedOperator` for @ref CeedOperatorView() output
 
@@ -1514,8 +1722,9 @@ int CeedOperatorSetName(CeedOperator op, const char *name) {
   @return Error code: 0 - success, otherwise - failure
 **/
 static int CeedOperatorView_Core(CeedOperator op, FILE *stream, bool is_full) {
-  bool has_name = op->name, is_composite;
+  bool has_name = op->name, is_composite, is_profiling;
 
+  CeedCall(CeedIsProfiling(op->ceed, &is_profiling));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     CeedInt       num_suboperators;
@@ -1529,16 +1738,22 @@ static int CeedOperatorView_Core(CeedOperator op, FILE *stream, bool is_full) {
       has_name = sub_operators[i]->name;
       fprintf(stream, "  SubOperator %" CeedInt_FMT "%s%s%s\n", i, has_name ? " - " : "", has_name ? sub_operators[i]->name : "", is_full ? ":" : "");
       if (is_full) CeedCall(CeedOperatorSingleView(sub_operators[i], 1, stream));
+      if (is_full && is_profiling) CeedCall(CeedOperatorPerformanceView(sub_operators[i], 1, stream));
     }
+    if (is_full && is_profiling) CeedCall(CeedOperatorPerformanceView(op, 0, stream));
   } else {
     fprintf(stream, "CeedOperator%s%s\n", has_name ? " - " : "", has_name ? op->name : "");
     if (is_full) CeedCall(CeedOperatorSingleView(op, 0, stream));
+    if (is_full && is_profiling) CeedCall(CeedOperatorPerformanceView(op, 0, stream));
   }
   return CEED_ERROR_SUCCESS;
 }
 
 /**
-  @brief View a `CeedOperator`
+  @brief View a `CeedOperator`.
+
+  If profiling is enabled with @ref CeedSetProfiling() or the environment variable `CEED_PROFILE`, the view also reports the wall time of the last `CeedOperatorApply()` or `CeedOperatorApplyAdd()` with the achieved bandwidth from @ref CeedOperatorGetMemoryTrafficEstimate(), and, if every `CeedQFunction` has a FLOPs estimate, the achieved GFLOP/s and arithmetic intensity.
+  For named `CeedOperator`, the hardware counter totals of each stage are also reported if enabled with @ref CeedSetProfilingCounters().
 
   @param[in] op     `CeedOperator` to view
   @param[in] stream Stream to write; typically `stdout` or a file
@@ -1735,6 +1950,76 @@ int CeedOperatorGetFlopsEstimate(CeedOperator op, CeedSize *flops) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Estimate number of bytes read and written to apply `CeedOperator`.
+
+  The estimate counts, for every field, the L-vector, offsets, and E-vector of the `CeedElemRestriction`, the E-vector and Q-vector of the `CeedBasis`, and the Q-vector of the `CeedQFunction`, including passive fields such as stored quadrature data.
+  Each stage is assumed to read its input from and write its output to memory, so backends that fuse stages move less data.
+
+  @param[in]  op    `CeedOperator` to estimate memory traffic for
+  @param[out] bytes Address of variable to hold memory traffic estimate
+
+  @ref Backend
+**/
+int CeedOperatorGetMemoryTrafficEstimate(CeedOperator op, CeedSize *bytes) {
+  bool is_composite;
+
+  CeedCall(CeedOperatorCheckReady(op));
+
+  *bytes = 0;
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt i = 0; i < num_suboperators; i++) {
+      CeedSize suboperator_bytes;
+
+      CeedCall(CeedOperatorGetMemoryTrafficEstimate(sub_operators[i], &suboperator_bytes));
+      *bytes += suboperator_bytes;
+    }
+  } else {
+    bool                is_at_points;
+    CeedInt             num_input_fields, num_output_fields;
+    CeedSize            num_points;
+    CeedQFunction       qf;
+    CeedQFunctionField *qf_input_fields, *qf_output_fields;
+    CeedOperatorField  *op_input_fields, *op_output_fields;
+
+    CeedCall(CeedOperatorGetQFunction(op, &qf));
+    CeedCall(CeedQFunctionGetFields(qf, &num_input_fields, &qf_input_fields, &num_output_fields, &qf_output_fields));
+    CeedCall(CeedOperatorGetFields(op, NULL, &op_input_fields, NULL, &op_output_fields));
+    CeedCall(CeedOperatorIsAtPoints(op, &is_at_points));
+    if (is_at_points) {
+      CeedInt             num_points_total;
+      CeedElemRestriction rstr_points;
+
+      CeedCall(CeedOperatorAtPointsGetPoints(op, &rstr_points, NULL));
+      CeedCall(CeedElemRestrictionGetNumPoints(rstr_points, &num_points_total));
+      CeedCall(CeedElemRestrictionDestroy(&rstr_points));
+      num_points = num_points_total;
+    } else {
+      num_points = (CeedSize)op->num_elem * op->num_qpts;
+    }
+
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedSize field_bytes;
+
+      CeedCall(CeedOperatorFieldGetMemoryTrafficEstimate(op_input_fields[i], qf_input_fields[i], num_points, true, &field_bytes));
+      *bytes += field_bytes;
+    }
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedSize field_bytes;
+
+      CeedCall(CeedOperatorFieldGetMemoryTrafficEstimate(op_output_fields[i], qf_output_fields[i], num_points, false, &field_bytes));
+      *bytes += field_bytes;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get `CeedQFunction` global context for a `CeedOperator`.
 
@@ -2044,14 +2329,19 @@ int CeedOperatorRestoreContextBooleanRead(CeedOperator op, CeedContextFieldLabel
   @ref User
 **/
 int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool    is_composite;
+  CeedInt event;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorProfileEventBegin(op, "CeedOperatorApply", in, out, &event));
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     // Composite Operator
-    if (op->ApplyComposite) {
+    bool has_fused_apply;
+
+    CeedCall(CeedCompositeOperatorHasFusedApply(op, &has_fused_apply));
+    if (op->ApplyComposite && !has_fused_apply) {
       CeedCall(op->ApplyComposite(op, in, out, request));
     } else {
       CeedInt       num_suboperators;
@@ -2084,7 +2374,17 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
     }
   } else {
     // Standard Operator
-    if (op->Apply) {
+    bool is_elem_mat_apply, is_fdm_apply;
+
+    CeedCall(CeedOperatorIsElementMatrixApply(op, &is_elem_mat_apply));
+    CeedCall(CeedOperatorIsFDMElementInverseApply(op, &is_fdm_apply));
+    if (is_elem_mat_apply) {
+      CeedCall(CeedVectorSetValue(out, 0.0));
+      if (op->num_elem > 0) CeedCall(op->ApplyAddElementMatrices(op, in, out, request));
+    } else if (is_fdm_apply) {
+      CeedCall(CeedVectorSetValue(out, 0.0));
+      if (op->num_elem > 0) CeedCall(op->ApplyAddFDMElementInverse(op, in, out, request));
+    } else if (op->Apply) {
       CeedCall(op->Apply(op, in, out, request));
     } else {
       CeedInt            num_output_fields;
@@ -2106,6 +2406,7 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
       if (op->num_elem > 0) CeedCall(op->ApplyAdd(op, in, out, request));
     }
   }
+  CeedCall(CeedProfileEventEnd(op->ceed, event, &op->apply_time));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2125,14 +2426,19 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   @ref User
 **/
 int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
-  bool is_composite;
+  bool    is_composite;
+  CeedInt event;
 
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorProfileEventBegin(op, "CeedOperatorApplyAdd", in, out, &event));
 
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     // Composite Operator
-    if (op->ApplyAddComposite) {
+    bool has_fused_apply;
+
+    CeedCall(CeedCompositeOperatorHasFusedApply(op, &has_fused_apply));
+    if (op->ApplyAddComposite && !has_fused_apply) {
       CeedCall(op->ApplyAddComposite(op, in, out, request));
     } else {
       CeedInt       num_suboperators;
@@ -2146,8 +2452,15 @@ int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedReq
     }
   } else if (op->num_elem > 0) {
     // Standard Operator
-    CeedCall(op->ApplyAdd(op, in, out, request));
+    bool is_elem_mat_apply, is_fdm_apply;
+
+    CeedCall(CeedOperatorIsElementMatrixApply(op, &is_elem_mat_apply));
+    CeedCall(CeedOperatorIsFDMElementInverseApply(op, &is_fdm_apply));
+    if (is_elem_mat_apply) CeedCall(op->ApplyAddElementMatrices(op, in, out, request));
+    else if (is_fdm_apply) CeedCall(op->ApplyAddFDMElementInverse(op, in, out, request));
+    else CeedCall(op->ApplyAdd(op, in, out, request));
   }
+  CeedCall(CeedProfileEventEnd(op->ceed, event, &op->apply_time));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2165,6 +2478,10 @@ int CeedOperatorAssemblyDataStrip(CeedOperator op) {
 
   CeedCall(CeedQFunctionAssemblyDataDestroy(&op->qf_assembled));
   CeedCall(CeedOperatorAssemblyDataDestroy(&op->op_assembled));
+  CeedCall(CeedFree(&op->csr_map));
+  CeedCall(CeedFree(&op->elem_mats));
+  CeedCall(CeedElemRestrictionDestroy(&op->elem_mat_rstr_in));
+  CeedCall(CeedElemRestrictionDestroy(&op->elem_mat_rstr_out));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   if (is_composite) {
     CeedInt       num_suboperators;
@@ -2175,6 +2492,7 @@ int CeedOperatorAssemblyDataStrip(CeedOperator op) {
     for (CeedInt i = 0; i < num_suboperators; i++) {
       CeedCall(CeedQFunctionAssemblyDataDestroy(&sub_operators[i]->qf_assembled));
       CeedCall(CeedOperatorAssemblyDataDestroy(&sub_operators[i]->op_assembled));
+      CeedCall(CeedFree(&sub_operators[i]->elem_mats));
     }
   }
   return CEED_ERROR_SUCCESS;
@@ -13,10 +13,18 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /// @file
 /// Implementation of CeedOperator preconditioning interfaces
 
+// Number of elements per batch when forming element matrices for full assembly
+#define CEED_ASSEMBLY_ELEM_BATCH_SIZE 8
+// Number of elements per chunk when building the nonzero pattern for full assembly
+#define CEED_ASSEMBLY_SYMBOLIC_CHUNK_SIZE 256
+
 /// ----------------------------------------------------------------------------
 /// CeedOperator Library Internal Preconditioning Functions
 /// ----------------------------------------------------------------------------
@@ -187,45 +195,129 @@ static int CeedOperatorCreateFallback(CeedOperator op) {
 }
 
 /**
-  @brief Core logic for assembling operator diagonal or point block diagonal
+  @brief Find the entries of the assembled `CeedQFunction` matrix that are nonzero at some quadrature point
 
-  @param[in]  op             `CeedOperator` to assemble diagonal or point block diagonal
-  @param[in]  request        Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
-  @param[in]  is_point_block Boolean flag to assemble diagonal or point block diagonal
-  @param[out] assembled      `CeedVector` to store assembled diagonal
+  @param[in]  assembled_qf_array Assembled `CeedQFunction` values
+  @param[in]  layout_qf          Strides between quadrature points, `CeedQFunction` matrix entries, and elements in the assembled `CeedQFunction`
+  @param[in]  num_elem           Number of elements in `assembled_qf_array`
+  @param[in]  num_qpts           Number of quadrature points per element
+  @param[in]  num_entries        Number of entries in the `CeedQFunction` matrix at each quadrature point
+  @param[out] is_nonzero         Array of length `num_entries` flagging the nonzero entries
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator op, CeedRequest *request, const bool is_point_block,
-                                                                   CeedVector assembled) {
-  Ceed ceed;
-  bool is_composite;
+static int CeedOperatorAssemblyQFunctionGetNonzeros(const CeedScalar *assembled_qf_array, const CeedInt layout_qf[3], CeedInt num_elem,
+                                                    CeedInt num_qpts, CeedSize num_entries, bool *is_nonzero) {
+  for (CeedSize i = 0; i < num_entries; i++) {
+    is_nonzero[i] = false;
+    // Stop scanning an entry at its first nonzero value
+    for (CeedInt e = 0; e < num_elem && !is_nonzero[i]; e++) {
+      for (CeedInt q = 0; q < num_qpts; q++) {
+        if (assembled_qf_array[q * layout_qf[0] + i * layout_qf[1] + e * layout_qf[2]] != 0.0) {
+          is_nonzero[i] = true;
+          break;
+        }
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
 
-  CeedCall(CeedOperatorGetCeed(op, &ceed));
-  CeedCall(CeedOperatorIsComposite(op, &is_composite));
-  CeedCheck(!is_composite, ceed, CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
+/**
+  @brief Detect the zero and symmetric structure of the assembled `CeedQFunction` matrix at each quadrature point.
 
-  // Assemble QFunction
-  CeedInt             layout_qf[3];
-  const CeedScalar   *assembled_qf_array;
-  CeedVector          assembled_qf        = NULL;
-  CeedElemRestriction assembled_elem_rstr = NULL;
+  The structure is probed once for each state of `assembled_qf` and stored in the `CeedOperatorAssemblyData` for use by full and diagonal assembly.
 
-  CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, request));
-  CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
-  CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
-  CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+  @param[in]  op                 `CeedOperator` with assembled `CeedQFunction`
+  @param[in]  assembled_qf       Assembled `CeedQFunction`
+  @param[in]  assembled_qf_array Assembled `CeedQFunction` values, read from `assembled_qf`
+  @param[in]  layout_qf          Strides between quadrature points, `CeedQFunction` matrix entries, and elements in the assembled `CeedQFunction`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorAssemblyDataUpdateQFunctionPattern(CeedOperator op, CeedVector assembled_qf, const CeedScalar *assembled_qf_array,
+                                                          const CeedInt layout_qf[3]) {
+  CeedInt                  num_elem, num_qpts;
+  CeedSize                 num_in, num_out;
+  uint64_t                 qf_state;
+  CeedOperatorAssemblyData data;
+
+  CeedCall(CeedOperatorGetOperatorAssemblyData(op, &data));
+  CeedCall(CeedVectorGetState(assembled_qf, &qf_state));
+  if (data->qf_is_nonzero && data->qf_pattern_state == qf_state) return CEED_ERROR_SUCCESS;
+
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCall(CeedOperatorGetNumQuadraturePoints(op, &num_qpts));
+  num_in  = data->num_input_components;
+  num_out = data->num_output_components;
+
+  // Nonzero entries
+  if (!data->qf_is_nonzero) CeedCall(CeedCalloc(num_in * num_out, &data->qf_is_nonzero));
+  CeedCall(CeedOperatorAssemblyQFunctionGetNonzeros(assembled_qf_array, layout_qf, num_elem, num_qpts, num_in * num_out, data->qf_is_nonzero));
+
+  // Symmetry
+  data->qf_is_symmetric = num_in == num_out;
+  for (CeedSize i = 0; i < num_in && data->qf_is_symmetric; i++) {
+    for (CeedSize j = i + 1; j < num_out && data->qf_is_symmetric; j++) {
+      if (data->qf_is_nonzero[i * num_out + j] != data->qf_is_nonzero[j * num_out + i]) {
+        data->qf_is_symmetric = false;
+      } else if (data->qf_is_nonzero[i * num_out + j]) {
+        for (CeedInt e = 0; e < num_elem && data->qf_is_symmetric; e++) {
+          for (CeedInt q = 0; q < num_qpts; q++) {
+            const CeedSize offset = q * layout_qf[0] + e * layout_qf[2];
+
+            if (assembled_qf_array[offset + (i * num_out + j) * layout_qf[1]] != assembled_qf_array[offset + (j * num_out + i) * layout_qf[1]]) {
+              data->qf_is_symmetric = false;
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+  data->qf_pattern_state = qf_state;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Core logic for assembling operator diagonal or point block diagonal, one block of elements at a time
+
+  The linearized `CeedQFunction` for each block of elements is either read from `assembled_qf_array` or evaluated by `assemble_block` into a buffer holding a single block.
+
+  @param[in]  op                 `CeedOperator` to assemble diagonal or point block diagonal
+  @param[in]  assembled_qf_array Assembled `CeedQFunction` for all elements, or `NULL` to use `assemble_block`
+  @param[in]  layout_qf          Strides between quadrature points, `CeedQFunction` matrix entries, and elements in the assembled `CeedQFunction`
+  @param[in]  block_size         Number of elements in each block
+  @param[in]  assemble_block     Function to assemble the `CeedQFunction` for a block of elements, or `NULL`
+  @param[in]  ctx                Context data passed to `assemble_block`
+  @param[in]  request            Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+  @param[in]  is_point_block     Boolean flag to assemble diagonal or point block diagonal
+  @param[out] assembled          `CeedVector` to store assembled diagonal
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorLinearAssembleAddDiagonal_Core(CeedOperator op, const CeedScalar *assembled_qf_array, const CeedInt layout_qf[3],
+                                                            CeedInt block_size, CeedOperatorLinearAssembleQFunctionBlock assemble_block, void *ctx,
+                                                            CeedRequest *request, const bool is_point_block, CeedVector assembled) {
+  Ceed ceed;
+
+  CeedCall(CeedOperatorGetCeed(op, &ceed));
 
   // Get assembly data
   const CeedEvalMode     **eval_modes_in, **eval_modes_out;
-  CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out;
+  CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out, num_pairs = 0, num_elem;
   CeedSize               **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
   CeedBasis               *active_bases_in, *active_bases_out;
   CeedElemRestriction     *active_elem_rstrs_in, *active_elem_rstrs_out;
   CeedOperatorAssemblyData data;
 
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
   CeedCall(CeedOperatorGetOperatorAssemblyData(op, &data));
   CeedCall(CeedOperatorAssemblyDataGetEvalModes(data, &num_active_bases_in, &num_eval_modes_in, &eval_modes_in, &eval_mode_offsets_in,
                                                 &num_active_bases_out, &num_eval_modes_out, &eval_modes_out, &eval_mode_offsets_out,
@@ -233,13 +325,27 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
   CeedCall(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases_in, NULL, NULL, &active_bases_out, NULL));
   CeedCall(CeedOperatorAssemblyDataGetElemRestrictions(data, NULL, &active_elem_rstrs_in, NULL, &active_elem_rstrs_out));
 
-  // Loop over all active bases (find matching input/output pairs)
-  for (CeedInt b = 0; b < CeedIntMin(num_active_bases_in, num_active_bases_out); b++) {
-    CeedInt             b_in, b_out, num_elem, num_nodes, num_qpts, num_comp;
-    bool                has_eval_none = false;
-    CeedScalar         *elem_diag_array, *identity = NULL;
-    CeedVector          elem_diag;
-    CeedElemRestriction diag_elem_rstr;
+  // Find matching input/output active bases
+  const CeedInt        max_pairs = CeedIntMin(num_active_bases_in, num_active_bases_out);
+  CeedInt             *b_ins, *b_outs, *num_nodes, *num_qpts, *num_comps;
+  CeedScalar         **elem_diag_arrays, **identities, *block_qf_array = NULL;
+  bool                *block_is_nonzero = NULL;
+  const bool          *qf_is_nonzero    = data->qf_is_nonzero;
+  CeedVector          *elem_diags;
+  CeedElemRestriction *diag_elem_rstrs;
+
+  CeedCall(CeedCalloc(max_pairs, &b_ins));
+  CeedCall(CeedCalloc(max_pairs, &b_outs));
+  CeedCall(CeedCalloc(max_pairs, &num_nodes));
+  CeedCall(CeedCalloc(max_pairs, &num_qpts));
+  CeedCall(CeedCalloc(max_pairs, &num_comps));
+  CeedCall(CeedCalloc(max_pairs, &elem_diag_arrays));
+  CeedCall(CeedCalloc(max_pairs, &identities));
+  CeedCall(CeedCalloc(max_pairs, &elem_diags));
+  CeedCall(CeedCalloc(max_pairs, &diag_elem_rstrs));
+  for (CeedInt b = 0; b < max_pairs; b++) {
+    CeedInt b_in, b_out;
+    bool    has_eval_none = false;
 
     if (num_active_bases_in <= num_active_bases_out) {
       b_in = b;
@@ -264,25 +370,24 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
     }
     CeedCheck(active_elem_rstrs_in[b_in] == active_elem_rstrs_out[b_out], ceed, CEED_ERROR_UNSUPPORTED,
               "Cannot assemble operator diagonal with different input and output active element restrictions");
+    b_ins[num_pairs]  = b_in;
+    b_outs[num_pairs] = b_out;
 
     // Assemble point block diagonal restriction, if needed
     if (is_point_block) {
-      CeedCall(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_elem_rstr));
+      CeedCall(CeedOperatorCreateActivePointBlockRestriction(active_elem_rstrs_in[b_in], &diag_elem_rstrs[num_pairs]));
     } else {
-      CeedCall(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_elem_rstr));
+      CeedCall(CeedElemRestrictionCreateUnsignedCopy(active_elem_rstrs_in[b_in], &diag_elem_rstrs[num_pairs]));
     }
 
     // Create diagonal vector
-    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstr, NULL, &elem_diag));
-
-    // Assemble element operator diagonals
-    CeedCall(CeedVectorSetValue(elem_diag, 0.0));
-    CeedCall(CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array));
-    CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstr, &num_elem));
-    CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes));
-    CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comp));
-    if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts = num_nodes;
-    else CeedCall(CeedBasisGetNumQuadraturePoints(active_bases_in[b_in], &num_qpts));
+    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstrs[num_pairs], NULL, &elem_diags[num_pairs]));
+    CeedCall(CeedVectorSetValue(elem_diags[num_pairs], 0.0));
+    CeedCall(CeedVectorGetArray(elem_diags[num_pairs], CEED_MEM_HOST, &elem_diag_arrays[num_pairs]));
+    CeedCall(CeedBasisGetNumNodes(active_bases_in[b_in], &num_nodes[num_pairs]));
+    CeedCall(CeedBasisGetNumComponents(active_bases_in[b_in], &num_comps[num_pairs]));
+    if (active_bases_in[b_in] == CEED_BASIS_NONE) num_qpts[num_pairs] = num_nodes[num_pairs];
+    else CeedCall(CeedBasisGetNumQuadraturePoints(active_bases_in[b_in], &num_qpts[num_pairs]));
 
     // Construct identity matrix for basis if required
     for (CeedInt i = 0; i < num_eval_modes_in[b_in]; i++) {
@@ -292,65 +397,92 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
       has_eval_none = has_eval_none || (eval_modes_out[b_out][i] == CEED_EVAL_NONE);
     }
     if (has_eval_none) {
-      CeedCall(CeedCalloc(num_qpts * num_nodes, &identity));
-      for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identity[i * num_nodes + i] = 1.0;
-    }
-
-    // Compute the diagonal of B^T D B
-    // Each element
-    for (CeedSize e = 0; e < num_elem; e++) {
-      // Each basis eval mode pair
-      CeedInt      d_out              = 0, q_comp_out;
-      CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
-
-      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
-        CeedInt           d_in              = 0, q_comp_in;
-        const CeedScalar *B_t               = NULL;
-        CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
-
-        CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identity, &B_t));
-        CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_out[b_out], eval_modes_out[b_out][e_out], &q_comp_out));
-        if (q_comp_out > 1) {
-          if (e_out == 0 || eval_modes_out[b_out][e_out] != eval_mode_out_prev) d_out = 0;
-          else B_t = &B_t[(++d_out) * num_qpts * num_nodes];
-        }
-        eval_mode_out_prev = eval_modes_out[b_out][e_out];
+      const CeedInt P = num_nodes[num_pairs], Q = num_qpts[num_pairs];
+
+      CeedCall(CeedCalloc(Q * P, &identities[num_pairs]));
+      for (CeedInt i = 0; i < (P < Q ? P : Q); i++) identities[num_pairs][i * P + i] = 1.0;
+    }
+    num_pairs++;
+  }
+
+  // Buffer for the assembled QFunction of a single block
+  CeedInt num_qpts_qf;
 
-        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
-          const CeedScalar *B = NULL;
+  CeedCall(CeedOperatorGetNumQuadraturePoints(op, &num_qpts_qf));
+  if (!assembled_qf_array) {
+    CeedCall(CeedCalloc((CeedSize)block_size * num_qpts_qf * data->num_input_components * num_output_components, &block_qf_array));
+    CeedCall(CeedCalloc(data->num_input_components * num_output_components, &block_is_nonzero));
+    qf_is_nonzero = block_is_nonzero;
+  }
+
+  // Compute the diagonal of B^T D B
+  // Each block of elements
+  for (CeedInt e_start = 0; e_start < num_elem; e_start += block_size) {
+    const CeedInt     num_elem_block = CeedIntMin(block_size, num_elem - e_start);
+    const CeedScalar *qf_array;
 
-          CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identity, &B));
-          CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
-          if (q_comp_in > 1) {
-            if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
-            else B = &B[(++d_in) * num_qpts * num_nodes];
+    // Assembled QFunction for block
+    if (assembled_qf_array) {
+      qf_array = &assembled_qf_array[(CeedSize)e_start * layout_qf[2]];
+    } else {
+      CeedCall(assemble_block(op, e_start, num_elem_block, ctx, block_qf_array, request));
+      CeedCall(CeedOperatorAssemblyQFunctionGetNonzeros(block_qf_array, layout_qf, num_elem_block, num_qpts_qf,
+                                                        data->num_input_components * num_output_components, block_is_nonzero));
+      qf_array = block_qf_array;
+    }
+
+    // Each active basis pair
+    for (CeedInt p = 0; p < num_pairs; p++) {
+      const CeedInt b_in = b_ins[p], b_out = b_outs[p], num_comp = num_comps[p], P = num_nodes[p], Q = num_qpts[p];
+      CeedScalar   *elem_diag_array = elem_diag_arrays[p];
+
+      // Each element
+      for (CeedInt e_block = 0; e_block < num_elem_block; e_block++) {
+        const CeedSize e = e_start + e_block;
+        // Each basis eval mode pair
+        CeedInt      d_out              = 0, q_comp_out;
+        CeedEvalMode eval_mode_out_prev = CEED_EVAL_NONE;
+
+        for (CeedInt e_out = 0; e_out < num_eval_modes_out[b_out]; e_out++) {
+          CeedInt           d_in              = 0, q_comp_in;
+          const CeedScalar *B_t               = NULL;
+          CeedEvalMode      eval_mode_in_prev = CEED_EVAL_NONE;
+
+          CeedCall(CeedOperatorGetBasisPointer(active_bases_out[b_out], eval_modes_out[b_out][e_out], identities[p], &B_t));
+          CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_out[b_out], eval_modes_out[b_out][e_out], &q_comp_out));
+          if (q_comp_out > 1) {
+            if (e_out == 0 || eval_modes_out[b_out][e_out] != eval_mode_out_prev) d_out = 0;
+            else B_t = &B_t[(++d_out) * Q * P];
           }
-          eval_mode_in_prev = eval_modes_in[b_in][e_in];
-
-          // Each component
-          for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
-            // Each qpt/node pair
-            for (CeedInt q = 0; q < num_qpts; q++) {
-              if (is_point_block) {
-                // Point Block Diagonal
-                for (CeedInt c_in = 0; c_in < num_comp; c_in++) {
-                  const CeedSize c_offset =
-                      (eval_mode_offsets_in[b_in][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
-                  const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e * layout_qf[2]];
-
-                  for (CeedInt n = 0; n < num_nodes; n++) {
-                    elem_diag_array[((e * num_comp + c_out) * num_comp + c_in) * num_nodes + n] +=
-                        B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
-                  }
-                }
-              } else {
-                // Diagonal Only
-                const CeedInt c_offset =
-                    (eval_mode_offsets_in[b_in][e_in] + c_out) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
-                const CeedScalar qf_value = assembled_qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e * layout_qf[2]];
-
-                for (CeedInt n = 0; n < num_nodes; n++) {
-                  elem_diag_array[(e * num_comp + c_out) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
+          eval_mode_out_prev = eval_modes_out[b_out][e_out];
+
+          for (CeedInt e_in = 0; e_in < num_eval_modes_in[b_in]; e_in++) {
+            const CeedScalar *B = NULL;
+
+            CeedCall(CeedOperatorGetBasisPointer(active_bases_in[b_in], eval_modes_in[b_in][e_in], identities[p], &B));
+            CeedCall(CeedBasisGetNumQuadratureComponents(active_bases_in[b_in], eval_modes_in[b_in][e_in], &q_comp_in));
+            if (q_comp_in > 1) {
+              if (e_in == 0 || eval_modes_in[b_in][e_in] != eval_mode_in_prev) d_in = 0;
+              else B = &B[(++d_in) * Q * P];
+            }
+            eval_mode_in_prev = eval_modes_in[b_in][e_in];
+
+            // Each component pair, skipping entries of the assembled QFunction that are zero
+            for (CeedInt c_out = 0; c_out < num_comp; c_out++) {
+              const CeedInt c_in_start = is_point_block ? 0 : c_out, c_in_stop = is_point_block ? num_comp : c_out + 1;
+
+              for (CeedInt c_in = c_in_start; c_in < c_in_stop; c_in++) {
+                const CeedSize c_offset =
+                    (eval_mode_offsets_in[b_in][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b_out][e_out] + c_out;
+                CeedScalar *elem_diag = is_point_block ? &elem_diag_array[((e * num_comp + c_out) * num_comp + c_in) * P]
+                                                       : &elem_diag_array[(e * num_comp + c_out) * P];
+
+                if (!qf_is_nonzero[c_offset]) continue;
+                // Each qpt/node pair
+                for (CeedInt q = 0; q < Q; q++) {
+                  const CeedScalar qf_value = qf_array[q * layout_qf[0] + c_offset * layout_qf[1] + e_block * layout_qf[2]];
+
+                  for (CeedInt n = 0; n < P; n++) elem_diag[n] += B_t[q * P + n] * qf_value * B[q * P + n];
                 }
               }
             }
@@ -358,16 +490,71 @@ static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator
         }
       }
     }
-    CeedCall(CeedVectorRestoreArray(elem_diag, &elem_diag_array));
-
-    // Assemble local operator diagonal
-    CeedCall(CeedElemRestrictionApply(diag_elem_rstr, CEED_TRANSPOSE, elem_diag, assembled, request));
+  }
 
-    // Cleanup
-    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstr));
-    CeedCall(CeedVectorDestroy(&elem_diag));
-    CeedCall(CeedFree(&identity));
+  // Assemble local operator diagonal
+  for (CeedInt p = 0; p < num_pairs; p++) {
+    CeedCall(CeedVectorRestoreArray(elem_diags[p], &elem_diag_arrays[p]));
+    CeedCall(CeedElemRestrictionApply(diag_elem_rstrs[p], CEED_TRANSPOSE, elem_diags[p], assembled, request));
   }
+
+  // Cleanup
+  for (CeedInt p = 0; p < num_pairs; p++) {
+    CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstrs[p]));
+    CeedCall(CeedVectorDestroy(&elem_diags[p]));
+    CeedCall(CeedFree(&identities[p]));
+  }
+  CeedCall(CeedFree(&block_qf_array));
+  CeedCall(CeedFree(&block_is_nonzero));
+  CeedCall(CeedFree(&b_ins));
+  CeedCall(CeedFree(&b_outs));
+  CeedCall(CeedFree(&num_nodes));
+  CeedCall(CeedFree(&num_qpts));
+  CeedCall(CeedFree(&num_comps));
+  CeedCall(CeedFree(&elem_diag_arrays));
+  CeedCall(CeedFree(&identities));
+  CeedCall(CeedFree(&elem_diags));
+  CeedCall(CeedFree(&diag_elem_rstrs));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Core logic for assembling operator diagonal or point block diagonal from the assembled `CeedQFunction` for all elements
+
+  @param[in]  op             `CeedOperator` to assemble diagonal or point block diagonal
+  @param[in]  request        Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+  @param[in]  is_point_block Boolean flag to assemble diagonal or point block diagonal
+  @param[out] assembled      `CeedVector` to store assembled diagonal
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static inline int CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(CeedOperator op, CeedRequest *request, const bool is_point_block,
+                                                                   CeedVector assembled) {
+  Ceed ceed;
+  bool is_composite;
+
+  CeedCall(CeedOperatorGetCeed(op, &ceed));
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(!is_composite, ceed, CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
+
+  // Assemble QFunction
+  CeedInt             layout_qf[3], num_elem;
+  const CeedScalar   *assembled_qf_array;
+  CeedVector          assembled_qf        = NULL;
+  CeedElemRestriction assembled_elem_rstr = NULL;
+
+  CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, request));
+  CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
+  CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
+  CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+  CeedCall(CeedOperatorAssemblyDataUpdateQFunctionPattern(op, assembled_qf, assembled_qf_array, layout_qf));
+
+  // Assemble diagonal
+  CeedCall(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCall(CeedSingleOperatorLinearAssembleAddDiagonal_Core(op, assembled_qf_array, layout_qf, num_elem, NULL, NULL, request, is_point_block,
+                                                            assembled));
   CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
   CeedCall(CeedVectorDestroy(&assembled_qf));
   return CEED_ERROR_SUCCESS;
@@ -427,115 +614,311 @@ static inline int CeedCompositeOperatorLinearAssembleAddDiagonal(CeedOperator op
 }
 
 /**
-  @brief Build nonzero pattern for non-composite CeedOperator`.
-
-  Users should generally use @ref CeedOperatorLinearAssembleSymbolic().
+  @brief Count number of entries for assembled `CeedOperator`
 
-  @param[in]  op     `CeedOperator` to assemble nonzero pattern
-  @param[in]  offset Offset for number of entries
-  @param[out] rows   Row number for each entry
-  @param[out] cols   Column number for each entry
+  @param[in]  op          `CeedOperator` to assemble
+  @param[out] num_entries Number of entries in assembled representation
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Developer
+  @ref Utility
 **/
-static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, CeedInt *rows, CeedInt *cols) {
-  Ceed                ceed;
+static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedSize *num_entries) {
   bool                is_composite;
-  CeedSize            num_nodes_in, num_nodes_out, local_num_entries, count = 0;
-  CeedInt             num_elem_in, elem_size_in, num_comp_in, layout_er_in[3];
-  CeedInt             num_elem_out, elem_size_out, num_comp_out, layout_er_out[3];
-  CeedScalar         *array;
-  const CeedScalar   *elem_dof_a_in, *elem_dof_a_out;
-  CeedVector          index_vec_in, index_vec_out, elem_dof_in, elem_dof_out;
-  CeedElemRestriction elem_rstr_in, elem_rstr_out, index_elem_rstr_in, index_elem_rstr_out;
+  CeedInt             num_elem_in, elem_size_in, num_comp_in, num_elem_out, elem_size_out, num_comp_out;
+  Ceed                ceed;
+  CeedElemRestriction rstr_in, rstr_out;
 
   CeedCall(CeedOperatorGetCeed(op, &ceed));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
   CeedCheck(!is_composite, ceed, CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
 
-  CeedCall(CeedOperatorGetActiveVectorLengths(op, &num_nodes_in, &num_nodes_out));
-  CeedCall(CeedOperatorGetActiveElemRestrictions(op, &elem_rstr_in, &elem_rstr_out));
-  CeedCall(CeedElemRestrictionGetNumElements(elem_rstr_in, &num_elem_in));
-  CeedCall(CeedElemRestrictionGetElementSize(elem_rstr_in, &elem_size_in));
-  CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr_in, &num_comp_in));
-  CeedCall(CeedElemRestrictionGetELayout(elem_rstr_in, layout_er_in));
-
-  // Determine elem_dof relation for input
-  CeedCall(CeedVectorCreate(ceed, num_nodes_in, &index_vec_in));
-  CeedCall(CeedVectorGetArrayWrite(index_vec_in, CEED_MEM_HOST, &array));
-  for (CeedSize i = 0; i < num_nodes_in; i++) array[i] = i;
-  CeedCall(CeedVectorRestoreArray(index_vec_in, &array));
-  CeedCall(CeedVectorCreate(ceed, num_elem_in * elem_size_in * num_comp_in, &elem_dof_in));
-  CeedCall(CeedVectorSetValue(elem_dof_in, 0.0));
-  CeedCall(CeedElemRestrictionCreateUnorientedCopy(elem_rstr_in, &index_elem_rstr_in));
-  CeedCall(CeedElemRestrictionApply(index_elem_rstr_in, CEED_NOTRANSPOSE, index_vec_in, elem_dof_in, CEED_REQUEST_IMMEDIATE));
-  CeedCall(CeedVectorGetArrayRead(elem_dof_in, CEED_MEM_HOST, &elem_dof_a_in));
-  CeedCall(CeedVectorDestroy(&index_vec_in));
-  CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr_in));
-
-  if (elem_rstr_in != elem_rstr_out) {
-    CeedCall(CeedElemRestrictionGetNumElements(elem_rstr_out, &num_elem_out));
+  CeedCall(CeedOperatorGetActiveElemRestrictions(op, &rstr_in, &rstr_out));
+  CeedCall(CeedElemRestrictionGetNumElements(rstr_in, &num_elem_in));
+  CeedCall(CeedElemRestrictionGetElementSize(rstr_in, &elem_size_in));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr_in, &num_comp_in));
+  if (rstr_in != rstr_out) {
+    CeedCall(CeedElemRestrictionGetNumElements(rstr_out, &num_elem_out));
     CeedCheck(num_elem_in == num_elem_out, ceed, CEED_ERROR_UNSUPPORTED,
               "Active input and output operator restrictions must have the same number of elements."
               " Input has %" CeedInt_FMT " elements; output has %" CeedInt_FMT "elements.",
               num_elem_in, num_elem_out);
-    CeedCall(CeedElemRestrictionGetElementSize(elem_rstr_out, &elem_size_out));
-    CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr_out, &num_comp_out));
-    CeedCall(CeedElemRestrictionGetELayout(elem_rstr_out, layout_er_out));
-
-    // Determine elem_dof relation for output
-    CeedCall(CeedVectorCreate(ceed, num_nodes_out, &index_vec_out));
-    CeedCall(CeedVectorGetArrayWrite(index_vec_out, CEED_MEM_HOST, &array));
-    for (CeedSize i = 0; i < num_nodes_out; i++) array[i] = i;
-    CeedCall(CeedVectorRestoreArray(index_vec_out, &array));
-    CeedCall(CeedVectorCreate(ceed, num_elem_out * elem_size_out * num_comp_out, &elem_dof_out));
-    CeedCall(CeedVectorSetValue(elem_dof_out, 0.0));
-    CeedCall(CeedElemRestrictionCreateUnorientedCopy(elem_rstr_out, &index_elem_rstr_out));
-    CeedCall(CeedElemRestrictionApply(index_elem_rstr_out, CEED_NOTRANSPOSE, index_vec_out, elem_dof_out, CEED_REQUEST_IMMEDIATE));
-    CeedCall(CeedVectorGetArrayRead(elem_dof_out, CEED_MEM_HOST, &elem_dof_a_out));
-    CeedCall(CeedVectorDestroy(&index_vec_out));
-    CeedCall(CeedElemRestrictionDestroy(&index_elem_rstr_out));
+    CeedCall(CeedElemRestrictionGetElementSize(rstr_out, &elem_size_out));
+    CeedCall(CeedElemRestrictionGetNumComponents(rstr_out, &num_comp_out));
   } else {
-    num_elem_out     = num_elem_in;
-    elem_size_out    = elem_size_in;
-    num_comp_out     = num_comp_in;
-    layout_er_out[0] = layout_er_in[0];
-    layout_er_out[1] = layout_er_in[1];
-    layout_er_out[2] = layout_er_in[2];
-    elem_dof_a_out   = elem_dof_a_in;
+    num_elem_out  = num_elem_in;
+    elem_size_out = elem_size_in;
+    num_comp_out  = num_comp_in;
   }
-  local_num_entries = (CeedSize)elem_size_out * num_comp_out * elem_size_in * num_comp_in * num_elem_in;
+  CeedCall(CeedElemRestrictionDestroy(&rstr_in));
+  CeedCall(CeedElemRestrictionDestroy(&rstr_out));
+  *num_entries = (CeedSize)elem_size_in * num_comp_in * elem_size_out * num_comp_out * num_elem_in;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Add coordinate format values to compressed sparse row values.
+
+  @param[in]     coo_values Values in coordinate format
+  @param[in]     csr_map    Compressed sparse row value index for each coordinate entry
+  @param[in,out] csr_values Compressed sparse row values to add to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorAssemblyAddCOOToCSR(CeedVector coo_values, const CeedInt *csr_map, CeedVector csr_values) {
+  CeedSize          num_entries;
+  CeedScalar       *csr_array;
+  const CeedScalar *coo_array;
+
+  CeedCall(CeedVectorGetLength(coo_values, &num_entries));
+  CeedCall(CeedVectorGetArrayRead(coo_values, CEED_MEM_HOST, &coo_array));
+  CeedCall(CeedVectorGetArray(csr_values, CEED_MEM_HOST, &csr_array));
+  for (CeedSize k = 0; k < num_entries; k++) csr_array[csr_map[k]] += coo_array[k];
+  CeedCall(CeedVectorRestoreArray(csr_values, &csr_array));
+  CeedCall(CeedVectorRestoreArrayRead(coo_values, &coo_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the L-vector index of each node and component of one element of an active `CeedElemRestriction`.
+
+  @param[in]  rstr    `CeedElemRestriction` to index
+  @param[in]  offsets Host offsets array of `rstr`, or `NULL` for strided restrictions
+  @param[in]  elem    Element to index
+  @param[out] indices L-vector index for each node and component, stored as `[components][nodes]`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssemblyGetElemIndices(CeedElemRestriction rstr, const CeedInt *offsets, CeedInt elem, CeedSize *indices) {
+  CeedInt elem_size, num_comp;
+
+  CeedCall(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  if (offsets) {
+    CeedInt block_size, comp_stride;
+
+    CeedCall(CeedElemRestrictionGetBlockSize(rstr, &block_size));
+    CeedCall(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+    const CeedSize elem_offset = (CeedSize)(elem / block_size) * block_size * elem_size + elem % block_size;
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      for (CeedInt i = 0; i < elem_size; i++) {
+        indices[comp * elem_size + i] = (CeedSize)offsets[elem_offset + i * block_size] + (CeedSize)comp * comp_stride;
+      }
+    }
+  } else {
+    CeedInt layout[3];
+
+    CeedCall(CeedElemRestrictionGetLLayout(rstr, layout));
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      for (CeedInt i = 0; i < elem_size; i++) {
+        indices[comp * elem_size + i] = (CeedSize)i * layout[0] + (CeedSize)comp * layout[1] + (CeedSize)elem * layout[2];
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build nonzero pattern for a range of elements of a non-composite `CeedOperator`.
+
+  The L-vector indices are read directly from the offsets or strides of the active `CeedElemRestriction`, so they are exact for any `CeedScalar` precision.
+  Exactly one of `rows` and `rows_64` and one of `cols` and `cols_64` should be non-`NULL`.
+
+  @param[in]  elem_rstr_in     Active input `CeedElemRestriction`
+  @param[in]  offsets_in       Offsets of `elem_rstr_in`, or `NULL` if strided
+  @param[in]  elem_rstr_out    Active output `CeedElemRestriction`
+  @param[in]  offsets_out      Offsets of `elem_rstr_out`, or `NULL` if strided
+  @param[in]  e_start          First element in range
+  @param[in]  e_stop           One past the last element in range
+  @param[in]  offset           Offset for first entry of the `CeedOperator`
+  @param[out] elem_indices_in  Work array for input L-vector indices of one element
+  @param[out] elem_indices_out Work array for output L-vector indices of one element
+  @param[out] rows             Row number for each entry, or `NULL`
+  @param[out] cols             Column number for each entry, or `NULL`
+  @param[out] rows_64          Row number for each entry with `CeedSize` indices, or `NULL`
+  @param[out] cols_64          Column number for each entry with `CeedSize` indices, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorAssembleSymbolicElements(CeedElemRestriction elem_rstr_in, const CeedInt *offsets_in, CeedElemRestriction elem_rstr_out,
+                                                      const CeedInt *offsets_out, CeedInt e_start, CeedInt e_stop, CeedSize offset,
+                                                      CeedSize *elem_indices_in, CeedSize *elem_indices_out, CeedInt *rows, CeedInt *cols,
+                                                      CeedSize *rows_64, CeedSize *cols_64) {
+  CeedInt elem_size_in, num_comp_in, elem_size_out, num_comp_out;
+
+  CeedCall(CeedElemRestrictionGetElementSize(elem_rstr_in, &elem_size_in));
+  CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr_in, &num_comp_in));
+  CeedCall(CeedElemRestrictionGetElementSize(elem_rstr_out, &elem_size_out));
+  CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr_out, &num_comp_out));
+  CeedSize count = offset + (CeedSize)e_start * elem_size_in * num_comp_in * elem_size_out * num_comp_out;
 
   // Determine i, j locations for element matrices
-  for (CeedInt e = 0; e < num_elem_in; e++) {
+  for (CeedInt e = e_start; e < e_stop; e++) {
+    CeedCall(CeedSingleOperatorAssemblyGetElemIndices(elem_rstr_in, offsets_in, e, elem_indices_in));
+    CeedCall(CeedSingleOperatorAssemblyGetElemIndices(elem_rstr_out, offsets_out, e, elem_indices_out));
     for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
       for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+        const CeedSize *row_indices = &elem_indices_out[comp_out * elem_size_out], *col_indices = &elem_indices_in[comp_in * elem_size_in];
+
         for (CeedInt i = 0; i < elem_size_out; i++) {
-          for (CeedInt j = 0; j < elem_size_in; j++) {
-            const CeedInt elem_dof_index_row = i * layout_er_out[0] + comp_out * layout_er_out[1] + e * layout_er_out[2];
-            const CeedInt elem_dof_index_col = j * layout_er_in[0] + comp_in * layout_er_in[1] + e * layout_er_in[2];
-            const CeedInt row                = elem_dof_a_out[elem_dof_index_row];
-            const CeedInt col                = elem_dof_a_in[elem_dof_index_col];
-
-            rows[offset + count] = row;
-            cols[offset + count] = col;
-            count++;
+          if (rows_64) {
+            for (CeedInt j = 0; j < elem_size_in; j++) {
+              rows_64[count + j] = row_indices[i];
+              cols_64[count + j] = col_indices[j];
+            }
+          } else {
+            for (CeedInt j = 0; j < elem_size_in; j++) {
+              rows[count + j] = (CeedInt)row_indices[i];
+              cols[count + j] = (CeedInt)col_indices[j];
+            }
           }
+          count += elem_size_in;
         }
       }
     }
   }
-  CeedCheck(count == local_num_entries, ceed, CEED_ERROR_MAJOR, "Error computing assembled entries");
-  CeedCall(CeedVectorRestoreArrayRead(elem_dof_in, &elem_dof_a_in));
-  CeedCall(CeedVectorDestroy(&elem_dof_in));
-  if (elem_rstr_in != elem_rstr_out) {
-    CeedCall(CeedVectorRestoreArrayRead(elem_dof_out, &elem_dof_a_out));
-    CeedCall(CeedVectorDestroy(&elem_dof_out));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Build nonzero pattern for `CeedOperator` with the default interface implementation.
+
+  Exactly one of `rows` and `rows_64` and one of `cols` and `cols_64` should be non-`NULL`; the corresponding arrays are allocated.
+
+  The entry offset of each sub-operator is computed first, so chunks of elements from all sub-operators are filled concurrently when built with `OPENMP=1`.
+
+  @param[in]  op          `CeedOperator` to assemble nonzero pattern
+  @param[out] num_entries Number of entries in coordinate nonzero pattern
+  @param[out] rows        Row number for each entry, or `NULL`
+  @param[out] cols        Column number for each entry, or `NULL`
+  @param[out] rows_64     Row number for each entry with `CeedSize` indices, or `NULL`
+  @param[out] cols_64     Column number for each entry with `CeedSize` indices, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols, CeedSize **rows_64,
+                                        CeedSize **cols_64) {
+  bool                 is_composite;
+  int                  ierr             = CEED_ERROR_SUCCESS;
+  CeedInt              num_suboperators = 1, num_threads = 1, max_elem_indices = 1, *chunk_offsets;
+  CeedSize            *entry_offsets, *work;
+  const CeedInt      **offsets_in, **offsets_out;
+  CeedOperator        *sub_operators = &op;
+  CeedElemRestriction *elem_rstrs_in, *elem_rstrs_out;
+
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  if (is_composite) {
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
   }
-  CeedCall(CeedElemRestrictionDestroy(&elem_rstr_in));
-  CeedCall(CeedElemRestrictionDestroy(&elem_rstr_out));
+
+  // Entry offsets, active restrictions, and element chunks for each sub-operator
+  CeedCall(CeedCalloc(num_suboperators + 1, &entry_offsets));
+  CeedCall(CeedCalloc(num_suboperators + 1, &chunk_offsets));
+  CeedCall(CeedCalloc(num_suboperators, &elem_rstrs_in));
+  CeedCall(CeedCalloc(num_suboperators, &elem_rstrs_out));
+  CeedCall(CeedCalloc(num_suboperators, &offsets_in));
+  CeedCall(CeedCalloc(num_suboperators, &offsets_out));
+  for (CeedInt k = 0; k < num_suboperators; k++) {
+    Ceed     ceed;
+    bool     is_strided;
+    CeedInt  num_elem, elem_size, num_comp;
+    CeedSize single_entries, num_nodes_in, num_nodes_out;
+
+    CeedCall(CeedOperatorGetCeed(sub_operators[k], &ceed));
+    CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
+    entry_offsets[k + 1] = entry_offsets[k] + single_entries;
+    CeedCall(CeedOperatorGetActiveVectorLengths(sub_operators[k], &num_nodes_in, &num_nodes_out));
+    CeedCheck(rows_64 || (num_nodes_in <= INT32_MAX && num_nodes_out <= INT32_MAX), ceed, CEED_ERROR_UNSUPPORTED,
+              "Active vector lengths %" CeedSize_FMT " and %" CeedSize_FMT " exceed CeedInt indices; use CeedOperatorLinearAssembleSymbolic64",
+              num_nodes_in, num_nodes_out);
+
+    CeedCall(CeedOperatorGetActiveElemRestrictions(sub_operators[k], &elem_rstrs_in[k], &elem_rstrs_out[k]));
+    CeedCall(CeedElemRestrictionGetNumElements(elem_rstrs_in[k], &num_elem));
+    chunk_offsets[k + 1] = chunk_offsets[k] + (num_elem + CEED_ASSEMBLY_SYMBOLIC_CHUNK_SIZE - 1) / CEED_ASSEMBLY_SYMBOLIC_CHUNK_SIZE;
+    CeedCall(CeedElemRestrictionIsStrided(elem_rstrs_in[k], &is_strided));
+    if (!is_strided) CeedCall(CeedElemRestrictionGetOffsets(elem_rstrs_in[k], CEED_MEM_HOST, &offsets_in[k]));
+    CeedCall(CeedElemRestrictionGetElementSize(elem_rstrs_in[k], &elem_size));
+    CeedCall(CeedElemRestrictionGetNumComponents(elem_rstrs_in[k], &num_comp));
+    max_elem_indices = CeedIntMax(max_elem_indices, elem_size * num_comp);
+    if (elem_rstrs_in[k] != elem_rstrs_out[k]) {
+      CeedCall(CeedElemRestrictionIsStrided(elem_rstrs_out[k], &is_strided));
+      if (!is_strided) CeedCall(CeedElemRestrictionGetOffsets(elem_rstrs_out[k], CEED_MEM_HOST, &offsets_out[k]));
+      CeedCall(CeedElemRestrictionGetElementSize(elem_rstrs_out[k], &elem_size));
+      CeedCall(CeedElemRestrictionGetNumComponents(elem_rstrs_out[k], &num_comp));
+      max_elem_indices = CeedIntMax(max_elem_indices, elem_size * num_comp);
+    } else {
+      offsets_out[k] = offsets_in[k];
+    }
+  }
+
+  // Allocate rows, cols arrays
+  *num_entries = entry_offsets[num_suboperators];
+  if (rows_64) {
+    CeedCall(CeedCalloc(*num_entries, rows_64));
+    CeedCall(CeedCalloc(*num_entries, cols_64));
+  } else {
+    CeedCall(CeedCalloc(*num_entries, rows));
+    CeedCall(CeedCalloc(*num_entries, cols));
+  }
+
+  // Assemble nonzero locations for each chunk of elements into the disjoint entry ranges
+  const CeedInt num_chunks = chunk_offsets[num_suboperators];
+
+#ifdef _OPENMP
+  if (!omp_in_parallel()) num_threads = CeedIntMax(1, CeedIntMin(omp_get_max_threads(), num_chunks));
+#endif
+  CeedCall(CeedCalloc(2 * max_elem_indices * num_threads, &work));
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(dynamic))
+  for (CeedInt chunk = 0; chunk < num_chunks; chunk++) {
+#ifdef _OPENMP
+    const CeedInt t = omp_get_thread_num();
+#else
+    const CeedInt t = 0;
+#endif
+    int       ierr_t = CEED_ERROR_SUCCESS;
+    CeedInt   k = 0, num_elem = 0;
+    CeedSize *elem_indices_in = &work[2 * max_elem_indices * t], *elem_indices_out = &elem_indices_in[max_elem_indices];
+
+    while (chunk >= chunk_offsets[k + 1]) k++;
+    ierr_t = CeedElemRestrictionGetNumElements(elem_rstrs_in[k], &num_elem);
+    if (ierr_t == CEED_ERROR_SUCCESS) {
+      const CeedInt e_start = (chunk - chunk_offsets[k]) * CEED_ASSEMBLY_SYMBOLIC_CHUNK_SIZE;
+      const CeedInt e_stop  = CeedIntMin(e_start + CEED_ASSEMBLY_SYMBOLIC_CHUNK_SIZE, num_elem);
+
+      ierr_t = CeedSingleOperatorAssembleSymbolicElements(elem_rstrs_in[k], offsets_in[k], elem_rstrs_out[k], offsets_out[k], e_start, e_stop,
+                                                          entry_offsets[k], elem_indices_in, elem_indices_out, rows ? *rows : NULL,
+                                                          cols ? *cols : NULL, rows_64 ? *rows_64 : NULL, cols_64 ? *cols_64 : NULL);
+    }
+    if (ierr_t != CEED_ERROR_SUCCESS) {
+      CeedPragmaCritical(CeedOperatorAssembleSymbolic) ierr = ierr_t;
+    }
+  }
+  CeedCall(ierr);
+
+  // Cleanup
+  for (CeedInt k = 0; k < num_suboperators; k++) {
+    if (offsets_in[k]) CeedCall(CeedElemRestrictionRestoreOffsets(elem_rstrs_in[k], &offsets_in[k]));
+    if (elem_rstrs_in[k] != elem_rstrs_out[k] && offsets_out[k]) CeedCall(CeedElemRestrictionRestoreOffsets(elem_rstrs_out[k], &offsets_out[k]));
+    CeedCall(CeedElemRestrictionDestroy(&elem_rstrs_in[k]));
+    CeedCall(CeedElemRestrictionDestroy(&elem_rstrs_out[k]));
+  }
+  CeedCall(CeedFree(&work));
+  CeedCall(CeedFree(&entry_offsets));
+  CeedCall(CeedFree(&chunk_offsets));
+  CeedCall(CeedFree(&elem_rstrs_in));
+  CeedCall(CeedFree(&elem_rstrs_out));
+  CeedCall(CeedFree(&offsets_in));
+  CeedCall(CeedFree(&offsets_out));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -544,15 +927,16 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
 
   Users should generally use @ref CeedOperatorLinearAssemble().
 
-  @param[in]  op     `CeedOperator` to assemble
-  @param[in]  offset Offset for number of entries
-  @param[out] values Values to assemble into matrix
+  @param[in]  op      `CeedOperator` to assemble
+  @param[in]  offset  Offset for number of entries
+  @param[in]  csr_map Compressed sparse row value index for each coordinate entry, or `NULL` to store values in coordinate format
+  @param[out] values  Values to assemble into matrix, or `NULL` to only update the element matrices stored in the `CeedOperator`
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
-static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVector values) {
+static int CeedSingleOperatorAssemble(CeedOperator op, CeedSize offset, const CeedInt *csr_map, CeedVector values) {
   Ceed ceed;
   bool is_composite;
 
@@ -568,17 +952,30 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
-  if (op->LinearAssembleSingle) {
+  if (op->LinearAssembleSingle && values) {
     // Backend version
-    CeedCall(op->LinearAssembleSingle(op, offset, values));
+    if (csr_map) {
+      CeedSize   num_entries;
+      CeedVector coo_values;
+
+      CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &num_entries));
+      CeedCall(CeedVectorCreate(ceed, num_entries, &coo_values));
+      CeedCall(CeedVectorSetValue(coo_values, 0.0));
+      CeedCall(op->LinearAssembleSingle(op, 0, coo_values));
+      CeedCall(CeedOperatorAssemblyAddCOOToCSR(coo_values, &csr_map[offset], values));
+      CeedCall(CeedVectorDestroy(&coo_values));
+    } else {
+      CeedCheck(offset <= INT32_MAX, ceed, CEED_ERROR_UNSUPPORTED, "Backend assembly requires an entry offset below 2^31");
+      CeedCall(op->LinearAssembleSingle(op, (CeedInt)offset, values));
+    }
     return CEED_ERROR_SUCCESS;
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
     CeedCall(CeedOperatorGetFallback(op, &op_fallback));
-    if (op_fallback) {
-      CeedCall(CeedSingleOperatorAssemble(op_fallback, offset, values));
+    if (op_fallback && values) {
+      CeedCall(CeedSingleOperatorAssemble(op_fallback, offset, csr_map, values));
       return CEED_ERROR_SUCCESS;
     }
   }
@@ -592,12 +989,41 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
   CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op, &assembled_qf, &assembled_elem_rstr, CEED_REQUEST_IMMEDIATE));
   CeedCall(CeedElemRestrictionGetELayout(assembled_elem_rstr, layout_qf));
   CeedCall(CeedElemRestrictionDestroy(&assembled_elem_rstr));
+
+  // Reuse stored element matrices if the assembled QFunction data is unchanged
+  bool         reuse_elem_mats = op->reuse_elem_mats || !values;
+  uint64_t     qf_state;
+  CeedOperator op_fallback_parent;
+
+  CeedCall(CeedOperatorGetFallbackParent(op, &op_fallback_parent));
+  if (op_fallback_parent) reuse_elem_mats = reuse_elem_mats || op_fallback_parent->reuse_elem_mats;
+  CeedCall(CeedVectorGetState(assembled_qf, &qf_state));
+  if (reuse_elem_mats && op->elem_mats && op->elem_mats_qf_state == qf_state) {
+    CeedSize    num_entries;
+    CeedScalar *vals;
+
+    if (!values) {
+      CeedCall(CeedVectorDestroy(&assembled_qf));
+      return CEED_ERROR_SUCCESS;
+    }
+
+    CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &num_entries));
+    CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
+    if (csr_map) {
+      for (CeedSize k = 0; k < num_entries; k++) vals[csr_map[offset + k]] += op->elem_mats[k];
+    } else {
+      memcpy(&vals[offset], op->elem_mats, num_entries * sizeof(CeedScalar));
+    }
+    CeedCall(CeedVectorRestoreArray(values, &vals));
+    CeedCall(CeedVectorDestroy(&assembled_qf));
+    return CEED_ERROR_SUCCESS;
+  }
   CeedCall(CeedVectorGetArrayRead(assembled_qf, CEED_MEM_HOST, &assembled_qf_array));
+  CeedCall(CeedOperatorAssemblyDataUpdateQFunctionPattern(op, assembled_qf, assembled_qf_array, layout_qf));
 
   // Get assembly data
   CeedInt                  num_elem_in, elem_size_in, num_comp_in, num_qpts_in;
   CeedInt                  num_elem_out, elem_size_out, num_comp_out, num_qpts_out;
-  CeedSize                 local_num_entries, count = 0;
   const CeedEvalMode     **eval_modes_in, **eval_modes_out;
   CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out;
   CeedBasis               *active_bases_in, *active_bases_out, basis_in, basis_out;
@@ -666,112 +1092,224 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
     elem_rstr_orients_out      = elem_rstr_orients_in;
     elem_rstr_curl_orients_out = elem_rstr_curl_orients_in;
   }
-  local_num_entries = (CeedSize)elem_size_out * num_comp_out * elem_size_in * num_comp_in * num_elem_in;
 
-  // Loop over elements and put in data structure
-  // We store B_mat_in, B_mat_out, BTD, elem_mat in row-major order
+  // Component pairs with nonzero element matrices
+  // With a symmetric assembled QFunction and matching input and output spaces, the element matrix for (comp_in, comp_out) is the transpose of the
+  //   element matrix for (comp_out, comp_in), so only one of each pair is computed
+  const bool *qf_is_nonzero = data->qf_is_nonzero;
+  bool        use_symmetry  = data->qf_is_symmetric && basis_in == basis_out && elem_rstr_in == elem_rstr_out;
+  CeedInt     num_pairs = 0, *pair_indices, *pair_comps_in, *pair_comps_out;
+  bool       *pair_is_mirror;
+
+  use_symmetry = use_symmetry && num_eval_modes_in[0] == num_eval_modes_out[0];
+  for (CeedInt e_in = 0; use_symmetry && e_in < num_eval_modes_in[0]; e_in++) use_symmetry = eval_modes_in[0][e_in] == eval_modes_out[0][e_in];
+  CeedCall(CeedCalloc(num_comp_in * num_comp_out, &pair_indices));
+  CeedCall(CeedCalloc(num_comp_in * num_comp_out, &pair_is_mirror));
+  CeedCall(CeedCalloc(num_comp_in * num_comp_out, &pair_comps_in));
+  CeedCall(CeedCalloc(num_comp_in * num_comp_out, &pair_comps_out));
+  for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+    for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+      const CeedInt pair       = comp_in * num_comp_out + comp_out;
+      bool          is_nonzero = false;
+
+      for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
+        for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
+          is_nonzero = is_nonzero || qf_is_nonzero[((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out];
+        }
+      }
+      if (!is_nonzero) {
+        pair_indices[pair] = -1;
+      } else if (use_symmetry && comp_in > comp_out) {
+        pair_indices[pair]   = pair_indices[comp_out * num_comp_out + comp_in];
+        pair_is_mirror[pair] = true;
+      } else {
+        pair_comps_in[num_pairs]  = comp_in;
+        pair_comps_out[num_pairs] = comp_out;
+        pair_indices[pair]        = num_pairs++;
+      }
+    }
+  }
+
+  // Loop over batches of elements and put in data structure
+  // We store B_mat_in, B_mat_out, DB, elem_mat in row-major order
+  // The element matrices for all elements and component pairs in a batch are formed with a single tensor contraction
+  int                ierr          = CEED_ERROR_SUCCESS;
+  CeedInt            num_threads   = 1;
+  const CeedInt      num_qe_in     = num_qpts_in * num_eval_modes_in[0], num_mats_elem = num_comp_in * num_comp_out;
+  const CeedInt      num_batches   = (num_elem_in + CEED_ASSEMBLY_ELEM_BATCH_SIZE - 1) / CEED_ASSEMBLY_ELEM_BATCH_SIZE;
+  const CeedSize     elem_mat_size = (CeedSize)elem_size_out * elem_size_in;
+  const CeedSize     work_size     = CEED_ASSEMBLY_ELEM_BATCH_SIZE * num_mats_elem * (num_qe_in * elem_size_out + elem_mat_size) + 2 * elem_mat_size;
   CeedTensorContract contract;
-  CeedScalar        *vals, *BTD_mat = NULL, *elem_mat = NULL, *elem_mat_b = NULL;
+  CeedScalar        *vals = NULL, *work;
 
   CeedCall(CeedBasisGetTensorContract(basis_in, &contract));
-  CeedCall(CeedCalloc(elem_size_out * num_qpts_in * num_eval_modes_in[0], &BTD_mat));
-  CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat));
-  if (elem_rstr_curl_orients_in || elem_rstr_curl_orients_out) CeedCall(CeedCalloc(elem_size_out * elem_size_in, &elem_mat_b));
-
-  CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
-  for (CeedSize e = 0; e < num_elem_in; e++) {
-    for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
-      for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
-        // Compute B^T*D
-        for (CeedSize n = 0; n < elem_size_out; n++) {
-          for (CeedSize q = 0; q < num_qpts_in; q++) {
-            for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
-              const CeedSize btd_index = n * (num_qpts_in * num_eval_modes_in[0]) + q * num_eval_modes_in[0] + e_in;
-              CeedScalar     sum       = 0.0;
-
-              for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
-                const CeedSize b_out_index     = (q * num_eval_modes_out[0] + e_out) * elem_size_out + n;
-                const CeedSize eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
-                const CeedSize qf_index        = q * layout_qf[0] + eval_mode_index * layout_qf[1] + e * layout_qf[2];
-
-                sum += B_mat_out[b_out_index] * assembled_qf_array[qf_index];
-              }
-              BTD_mat[btd_index] = sum;
+#ifdef _OPENMP
+  if (!omp_in_parallel()) num_threads = CeedIntMax(1, CeedIntMin(omp_get_max_threads(), num_batches));
+#endif
+  CeedCall(CeedCalloc(work_size * num_threads, &work));
+  if (reuse_elem_mats) {
+    CeedCall(CeedFree(&op->elem_mats));
+    CeedCall(CeedCalloc((CeedSize)num_elem_in * num_mats_elem * elem_mat_size, &op->elem_mats));
+    op->elem_mats_qf_state = qf_state;
+  }
+
+  if (values) CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
+  CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
+  for (CeedInt batch = 0; batch < num_batches; batch++) {
+#ifdef _OPENMP
+    const CeedInt t = omp_get_thread_num();
+#else
+    const CeedInt t = 0;
+#endif
+    const CeedInt e_start = batch * CEED_ASSEMBLY_ELEM_BATCH_SIZE, e_stop = CeedIntMin(e_start + CEED_ASSEMBLY_ELEM_BATCH_SIZE, num_elem_in);
+    const CeedInt num_mats = (e_stop - e_start) * num_pairs;
+    CeedScalar   *DB_mats = &work[t * work_size], *elem_mats_t = &DB_mats[(CeedSize)num_mats * num_qe_in * elem_size_out];
+    CeedScalar   *elem_mat = &elem_mats_t[num_mats * elem_mat_size], *elem_mat_b = &elem_mat[elem_mat_size];
+    int           ierr_t   = CEED_ERROR_SUCCESS;
+
+    // Compute D*B_out for each element and computed component pair in the batch
+    for (CeedInt e = e_start; e < e_stop; e++) {
+      for (CeedInt pair = 0; pair < num_pairs; pair++) {
+        const CeedInt comp_in = pair_comps_in[pair], comp_out = pair_comps_out[pair];
+        CeedScalar   *DB_mat = &DB_mats[(CeedSize)((e - e_start) * num_pairs + pair) * num_qe_in * elem_size_out];
+
+        for (CeedInt q = 0; q < num_qpts_in; q++) {
+          for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
+            CeedScalar *DB_row = &DB_mat[(q * num_eval_modes_in[0] + e_in) * elem_size_out];
+
+            for (CeedInt n = 0; n < elem_size_out; n++) DB_row[n] = 0.0;
+            for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
+              const CeedSize    eval_mode_index = ((e_in * num_comp_in + comp_in) * num_eval_modes_out[0] + e_out) * num_comp_out + comp_out;
+              const CeedScalar *B_out_row       = &B_mat_out[(q * num_eval_modes_out[0] + e_out) * elem_size_out];
+              CeedScalar        d;
+
+              if (!qf_is_nonzero[eval_mode_index]) continue;
+              d = assembled_qf_array[q * layout_qf[0] + eval_mode_index * layout_qf[1] + e * layout_qf[2]];
+              CeedPragmaSIMD for (CeedInt n = 0; n < elem_size_out; n++) DB_row[n] += d * B_out_row[n];
             }
           }
         }
+      }
+    }
 
-        // Form element matrix itself (for each block component)
-        if (contract) {
-          CeedCall(CeedTensorContractApply(contract, 1, num_qpts_in * num_eval_modes_in[0], elem_size_in, elem_size_out, BTD_mat, CEED_NOTRANSPOSE,
-                                           false, B_mat_in, elem_mat));
-        } else {
-          CeedCall(CeedMatrixMatrixMultiply(ceed, BTD_mat, B_mat_in, elem_mat, elem_size_out, elem_size_in, num_qpts_in * num_eval_modes_in[0]));
-        }
+    // Form transposed element matrices B_in^T*(D*B_out) for the batch
+    if (contract && num_mats > 0) {
+      ierr_t = CeedTensorContractApply(contract, num_mats, num_qe_in, elem_size_out, elem_size_in, B_mat_in, CEED_TRANSPOSE, false, DB_mats,
+                                       elem_mats_t);
+    } else {
+      for (CeedInt a = 0; a < num_mats; a++) {
+        for (CeedInt j = 0; j < elem_size_in; j++) {
+          CeedScalar *elem_mat_t_row = &elem_mats_t[a * elem_mat_size + j * elem_size_out];
 
-        // Transform the element matrix if required
-        if (elem_rstr_orients_out) {
-          const bool *elem_orients = &elem_rstr_orients_out[e * elem_size_out];
+          for (CeedInt n = 0; n < elem_size_out; n++) elem_mat_t_row[n] = 0.0;
+          for (CeedInt b = 0; b < num_qe_in; b++) {
+            const CeedScalar  B_in_bj = B_mat_in[b * elem_size_in + j];
+            const CeedScalar *DB_row  = &DB_mats[((CeedSize)a * num_qe_in + b) * elem_size_out];
 
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            const double orient = elem_orients[i] ? -1.0 : 1.0;
+            CeedPragmaSIMD for (CeedInt n = 0; n < elem_size_out; n++) elem_mat_t_row[n] += B_in_bj * DB_row[n];
+          }
+        }
+      }
+    }
 
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] *= orient;
+    for (CeedInt e = e_start; e < e_stop && ierr_t == CEED_ERROR_SUCCESS; e++) {
+      for (CeedInt comp_in = 0; comp_in < num_comp_in; comp_in++) {
+        for (CeedInt comp_out = 0; comp_out < num_comp_out; comp_out++) {
+          const CeedInt  pair  = pair_indices[comp_in * num_comp_out + comp_out];
+          const CeedSize entry = offset + ((CeedSize)e * num_mats_elem + comp_in * num_comp_out + comp_out) * elem_mat_size;
+
+          // Zero element matrix
+          if (pair < 0) {
+            if (vals && !csr_map) {
+              for (CeedSize k = 0; k < elem_mat_size; k++) vals[entry + k] = 0.0;
             }
+            if (reuse_elem_mats) memset(&op->elem_mats[entry - offset], 0, elem_mat_size * sizeof(CeedScalar));
+            continue;
           }
-        } else if (elem_rstr_curl_orients_out) {
-          const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_out[e * 3 * elem_size_out];
 
-          // T^T*(B^T*D*B)
-          memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
-                                               (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
-                                               (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3] : 0.0);
+          // Transpose element matrix; the stored matrix for a mirrored pair is already the transpose
+          const CeedScalar *elem_mat_t = &elem_mats_t[((e - e_start) * num_pairs + pair) * elem_mat_size];
+
+          if (pair_is_mirror[comp_in * num_comp_out + comp_out]) {
+            memcpy(elem_mat, elem_mat_t, elem_mat_size * sizeof(CeedScalar));
+          } else {
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) elem_mat[i * elem_size_in + j] = elem_mat_t[j * elem_size_out + i];
             }
           }
-        }
-        if (elem_rstr_orients_in) {
-          const bool *elem_orients = &elem_rstr_orients_in[e * elem_size_in];
 
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
+          // Transform the element matrix if required
+          if (elem_rstr_orients_out) {
+            const bool *elem_orients = &elem_rstr_orients_out[e * elem_size_out];
+
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              const double orient = elem_orients[i] ? -1.0 : 1.0;
+
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] *= orient;
+              }
+            }
+          } else if (elem_rstr_curl_orients_out) {
+            const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_out[e * 3 * elem_size_out];
+
+            // T^T*(B^T*D*B)
+            memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * i + 1] +
+                                                 (i > 0 ? elem_mat_b[(i - 1) * elem_size_in + j] * elem_curl_orients[3 * i - 1] : 0.0) +
+                                                 (i < elem_size_out - 1 ? elem_mat_b[(i + 1) * elem_size_in + j] * elem_curl_orients[3 * i + 3]
+                                                                        : 0.0);
+              }
             }
           }
-        } else if (elem_rstr_curl_orients_in) {
-          const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_in[e * 3 * elem_size_in];
+          if (elem_rstr_orients_in) {
+            const bool *elem_orients = &elem_rstr_orients_in[e * elem_size_in];
 
-          // (B^T*D*B)*T
-          memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
-          for (CeedInt i = 0; i < elem_size_out; i++) {
-            for (CeedInt j = 0; j < elem_size_in; j++) {
-              elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
-                                               (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
-                                               (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] *= elem_orients[j] ? -1.0 : 1.0;
+              }
+            }
+          } else if (elem_rstr_curl_orients_in) {
+            const CeedInt8 *elem_curl_orients = &elem_rstr_curl_orients_in[e * 3 * elem_size_in];
+
+            // (B^T*D*B)*T
+            memcpy(elem_mat_b, elem_mat, elem_size_out * elem_size_in * sizeof(CeedScalar));
+            for (CeedInt i = 0; i < elem_size_out; i++) {
+              for (CeedInt j = 0; j < elem_size_in; j++) {
+                elem_mat[i * elem_size_in + j] = elem_mat_b[i * elem_size_in + j] * elem_curl_orients[3 * j + 1] +
+                                                 (j > 0 ? elem_mat_b[i * elem_size_in + j - 1] * elem_curl_orients[3 * j - 1] : 0.0) +
+                                                 (j < elem_size_in - 1 ? elem_mat_b[i * elem_size_in + j + 1] * elem_curl_orients[3 * j + 3] : 0.0);
+              }
             }
           }
-        }
 
-        // Put element matrix in coordinate data structure
-        for (CeedInt i = 0; i < elem_size_out; i++) {
-          for (CeedInt j = 0; j < elem_size_in; j++) {
-            vals[offset + count] = elem_mat[i * elem_size_in + j];
-            count++;
+          // Put element matrix in coordinate data structure, or accumulate into compressed sparse row values
+          if (vals && csr_map) {
+            for (CeedSize k = 0; k < elem_mat_size; k++) {
+              CeedPragmaAtomic vals[csr_map[entry + k]] += elem_mat[k];
+            }
+          } else if (vals) {
+            for (CeedSize k = 0; k < elem_mat_size; k++) vals[entry + k] = elem_mat[k];
           }
+          if (reuse_elem_mats) memcpy(&op->elem_mats[entry - offset], elem_mat, elem_mat_size * sizeof(CeedScalar));
         }
       }
     }
+    if (ierr_t != CEED_ERROR_SUCCESS) {
+      CeedPragmaCritical(CeedSingleOperatorAssemble) ierr = ierr_t;
+    }
   }
-  CeedCheck(count == local_num_entries, ceed, CEED_ERROR_MAJOR, "Error computing entries");
-  CeedCall(CeedVectorRestoreArray(values, &vals));
+  if (values) CeedCall(CeedVectorRestoreArray(values, &vals));
+  CeedCall(ierr);
 
   // Cleanup
-  CeedCall(CeedFree(&BTD_mat));
-  CeedCall(CeedFree(&elem_mat));
-  CeedCall(CeedFree(&elem_mat_b));
+  CeedCall(CeedFree(&work));
+  CeedCall(CeedFree(&pair_indices));
+  CeedCall(CeedFree(&pair_is_mirror));
+  CeedCall(CeedFree(&pair_comps_in));
+  CeedCall(CeedFree(&pair_comps_out));
   if (elem_rstr_type_in == CEED_RESTRICTION_ORIENTED) {
     CeedCall(CeedElemRestrictionRestoreOrientations(elem_rstr_in, &elem_rstr_orients_in));
   } else if (elem_rstr_type_in == CEED_RESTRICTION_CURL_ORIENTED) {
@@ -792,66 +1330,182 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
 }
 
 /**
-  @brief Count number of entries for assembled `CeedOperator`
+  @brief Get the combined state of the passive input `CeedVector` and `CeedQFunctionContext` of a non-composite `CeedOperator`.
+
+  The states only increase, so the sum changes whenever any passive input or the context data is written.
+
+  @param[in]  op    `CeedOperator` to check
+  @param[out] state Variable to store combined state
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetPassiveInputState(CeedOperator op, uint64_t *state) {
+  CeedInt              num_input_fields;
+  CeedOperatorField   *input_fields;
+  CeedQFunctionContext ctx;
+
+  *state = 0;
+  CeedCall(CeedOperatorGetFields(op, &num_input_fields, &input_fields, NULL, NULL));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+
+    CeedCall(CeedOperatorFieldGetVector(input_fields[i], &vec));
+    if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
+      uint64_t vec_state;
+
+      CeedCall(CeedVectorGetState(vec, &vec_state));
+      *state += vec_state;
+    }
+    CeedCall(CeedVectorDestroy(&vec));
+  }
+  CeedCall(CeedQFunctionGetContext(op->qf, &ctx));
+  if (ctx) {
+    uint64_t ctx_state;
+
+    CeedCall(CeedQFunctionContextGetState(ctx, &ctx_state));
+    *state += ctx_state;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Determine if a non-composite `CeedOperator` is applied with stored element matrices.
+
+  Element matrices are used when allowed with @ref CeedOperatorSetElementMatrixApply(), the backend provides `CeedOperatorApplyAddElementMatrices`, the `CeedOperator` has a single active input and output basis and no passive outputs, and the element matrix products need fewer flops than @ref CeedOperatorGetFlopsEstimate().
+  The decision is made on first use and stored in the `CeedOperator`.
+
+  @param[in]  op                `CeedOperator` to check
+  @param[out] is_elem_mat_apply Variable to store decision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorIsElementMatrixApply(CeedOperator op, bool *is_elem_mat_apply) {
+  *is_elem_mat_apply = false;
+  if (!op->allow_elem_mat_apply) return CEED_ERROR_SUCCESS;
+
+  if (!op->is_elem_mat_apply_setup) {
+    bool use_elem_mats = !op->is_at_points && !op->is_composite && op->ApplyAddElementMatrices;
+
+    // Only active outputs are computed from element matrices
+    if (use_elem_mats) {
+      CeedInt            num_output_fields;
+      CeedOperatorField *output_fields;
+
+      CeedCall(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &output_fields));
+      for (CeedInt i = 0; i < num_output_fields; i++) {
+        CeedVector vec;
+
+        CeedCall(CeedOperatorFieldGetVector(output_fields[i], &vec));
+        if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) use_elem_mats = false;
+        CeedCall(CeedVectorDestroy(&vec));
+      }
+    }
+
+    // Assembly requires a single active basis
+    if (use_elem_mats) {
+      CeedInt                  num_active_bases_in, *num_eval_modes_in, num_active_bases_out, *num_eval_modes_out;
+      CeedOperatorAssemblyData data;
+
+      CeedCall(CeedOperatorGetOperatorAssemblyData(op, &data));
+      CeedCall(CeedOperatorAssemblyDataGetEvalModes(data, &num_active_bases_in, &num_eval_modes_in, NULL, NULL, &num_active_bases_out,
+                                                    &num_eval_modes_out, NULL, NULL, NULL));
+      use_elem_mats = num_active_bases_in == 1 && num_active_bases_out == 1 && num_eval_modes_in[0] > 0 && num_eval_modes_out[0] > 0;
+    }
+
+    // Compare flops for element matrix products and matrix-free application
+    if (use_elem_mats) {
+      CeedSize            flops_matrix_free, flops_rstr_in, flops_rstr_out, num_entries;
+      CeedElemRestriction rstr_in, rstr_out;
+
+      CeedCall(CeedOperatorGetFlopsEstimate(op, &flops_matrix_free));
+      CeedCall(CeedOperatorGetActiveElemRestrictions(op, &rstr_in, &rstr_out));
+      CeedCall(CeedElemRestrictionGetFlopsEstimate(rstr_in, CEED_NOTRANSPOSE, &flops_rstr_in));
+      CeedCall(CeedElemRestrictionGetFlopsEstimate(rstr_out, CEED_TRANSPOSE, &flops_rstr_out));
+      CeedCall(CeedElemRestrictionDestroy(&rstr_in));
+      CeedCall(CeedElemRestrictionDestroy(&rstr_out));
+      CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &num_entries));
+      use_elem_mats = flops_rstr_in + 2 * num_entries + flops_rstr_out < flops_matrix_free;
+    }
+    op->use_elem_mat_apply      = use_elem_mats;
+    op->is_elem_mat_apply_setup = true;
+  }
+  *is_elem_mat_apply = op->use_elem_mat_apply;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Determine if a `CeedOperator` created by @ref CeedOperatorCreateFDMElementInverse() is applied with fused element passes.
+
+  The fused application is used when the backend provides `CeedOperatorApplyAddFDMElementInverse`, currently the `/cpu/self` backends.
+  Other backends apply the `CeedOperator` with the scaling `CeedQFunction`.
+
+  @param[in]  op           `CeedOperator` to check
+  @param[out] is_fdm_apply Variable to store decision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorIsFDMElementInverseApply(CeedOperator op, bool *is_fdm_apply) {
+  *is_fdm_apply = op->is_fdm_inverse && op->ApplyAddFDMElementInverse;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create the scaling `CeedQFunction` used by multigrid prolongation and restriction `CeedOperator`
 
-  @param[in]  op          `CeedOperator` to assemble
-  @param[out] num_entries Number of entries in assembled representation
+  @param[in]  ceed       `Ceed` object used to create the `CeedQFunction`
+  @param[in]  num_comp   Number of components of the active vector
+  @param[in]  is_prolong Boolean flag indicating the `CeedQFunction` is for prolongation, otherwise for restriction
+  @param[out] qf_scale   Address of the variable where the newly created `CeedQFunction` will be stored
 
   @return An error code: 0 - success, otherwise - failure
 
-  @ref Utility
+  @ref Developer
 **/
-static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedSize *num_entries) {
-  bool                is_composite;
-  CeedInt             num_elem_in, elem_size_in, num_comp_in, num_elem_out, elem_size_out, num_comp_out;
-  Ceed                ceed;
-  CeedElemRestriction rstr_in, rstr_out;
-
-  CeedCall(CeedOperatorGetCeed(op, &ceed));
-  CeedCall(CeedOperatorIsComposite(op, &is_composite));
-  CeedCheck(!is_composite, ceed, CEED_ERROR_UNSUPPORTED, "Composite operator not supported");
-
-  CeedCall(CeedOperatorGetActiveElemRestrictions(op, &rstr_in, &rstr_out));
-  CeedCall(CeedElemRestrictionGetNumElements(rstr_in, &num_elem_in));
-  CeedCall(CeedElemRestrictionGetElementSize(rstr_in, &elem_size_in));
-  CeedCall(CeedElemRestrictionGetNumComponents(rstr_in, &num_comp_in));
-  if (rstr_in != rstr_out) {
-    CeedCall(CeedElemRestrictionGetNumElements(rstr_out, &num_elem_out));
-    CeedCheck(num_elem_in == num_elem_out, ceed, CEED_ERROR_UNSUPPORTED,
-              "Active input and output operator restrictions must have the same number of elements."
-              " Input has %" CeedInt_FMT " elements; output has %" CeedInt_FMT "elements.",
-              num_elem_in, num_elem_out);
-    CeedCall(CeedElemRestrictionGetElementSize(rstr_out, &elem_size_out));
-    CeedCall(CeedElemRestrictionGetNumComponents(rstr_out, &num_comp_out));
-  } else {
-    num_elem_out  = num_elem_in;
-    elem_size_out = elem_size_in;
-    num_comp_out  = num_comp_in;
-  }
-  CeedCall(CeedElemRestrictionDestroy(&rstr_in));
-  CeedCall(CeedElemRestrictionDestroy(&rstr_out));
-  *num_entries = (CeedSize)elem_size_in * num_comp_in * elem_size_out * num_comp_out * num_elem_in;
+static int CeedQFunctionCreateMultigridScale(Ceed ceed, CeedInt num_comp, bool is_prolong, CeedQFunction *qf_scale) {
+  CeedInt             *num_comp_data;
+  CeedQFunctionContext ctx;
+
+  CeedCall(CeedQFunctionCreateInteriorByName(ceed, "Scale", qf_scale));
+  CeedCall(CeedCalloc(1, &num_comp_data));
+  num_comp_data[0] = num_comp;
+  CeedCall(CeedQFunctionContextCreate(ceed, &ctx));
+  CeedCall(CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_OWN_POINTER, sizeof(*num_comp_data), num_comp_data));
+  CeedCall(CeedQFunctionSetContext(*qf_scale, ctx));
+  CeedCall(CeedQFunctionContextDestroy(&ctx));
+  CeedCall(CeedQFunctionAddInput(*qf_scale, "input", num_comp, is_prolong ? CEED_EVAL_INTERP : CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionAddInput(*qf_scale, "scale", num_comp, CEED_EVAL_NONE));
+  CeedCall(CeedQFunctionAddOutput(*qf_scale, "output", num_comp, is_prolong ? CEED_EVAL_NONE : CEED_EVAL_INTERP));
+  CeedCall(CeedQFunctionSetUserFlopsEstimate(*qf_scale, num_comp));
   return CEED_ERROR_SUCCESS;
 }
 
 /**
   @brief Common code for creating a multigrid coarse `CeedOperator` and level transfer `CeedOperator` for a `CeedOperator`
 
-  @param[in]  op_fine      Fine grid `CeedOperator`
-  @param[in]  p_mult_fine  L-vector multiplicity in parallel gather/scatter, or `NULL` if not creating prolongation/restriction `CeedOperator`
-  @param[in]  rstr_coarse  Coarse grid `CeedElemRestriction`
-  @param[in]  basis_coarse Coarse grid active vector `CeedBasis`
-  @param[in]  basis_c_to_f `CeedBasis` for coarse to fine interpolation, or `NULL` if not creating prolongation/restriction operators
-  @param[out] op_coarse    Coarse grid `CeedOperator`
-  @param[out] op_prolong   Coarse to fine `CeedOperator`, or `NULL`
-  @param[out] op_restrict  Fine to coarse `CeedOperator`, or `NULL`
+  @param[in]  op_fine        Fine grid `CeedOperator`
+  @param[in]  p_mult_fine    L-vector multiplicity in parallel gather/scatter, or `NULL` if not creating prolongation/restriction `CeedOperator`
+  @param[in]  rstr_coarse    Coarse grid `CeedElemRestriction`
+  @param[in]  basis_coarse   Coarse grid active vector `CeedBasis`
+  @param[in]  basis_c_to_f   `CeedBasis` for coarse to fine interpolation, or `NULL` if not creating prolongation/restriction operators
+  @param[in]  qf_prolong_in  Scaling `CeedQFunction` shared between prolongation `CeedOperator`, or `NULL` to create one
+  @param[in]  qf_restrict_in Scaling `CeedQFunction` shared between restriction `CeedOperator`, or `NULL` to create one
+  @param[out] op_coarse      Coarse grid `CeedOperator`
+  @param[out] op_prolong     Coarse to fine `CeedOperator`, or `NULL`
+  @param[out] op_restrict    Fine to coarse `CeedOperator`, or `NULL`
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
 static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse, CeedBasis basis_coarse,
-                                            CeedBasis basis_c_to_f, CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict) {
+                                            CeedBasis basis_c_to_f, CeedQFunction qf_prolong_in, CeedQFunction qf_restrict_in,
+                                            CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict) {
   bool                is_composite;
   Ceed                ceed;
   CeedInt             num_comp, num_input_fields, num_output_fields;
@@ -953,22 +1607,10 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
 
   // Restriction
   if (op_restrict) {
-    CeedInt             *num_comp_r_data;
-    CeedQFunctionContext ctx_r;
-    CeedQFunction        qf_restrict;
-
-    CeedCall(CeedQFunctionCreateInteriorByName(ceed, "Scale", &qf_restrict));
-    CeedCall(CeedCalloc(1, &num_comp_r_data));
-    num_comp_r_data[0] = num_comp;
-    CeedCall(CeedQFunctionContextCreate(ceed, &ctx_r));
-    CeedCall(CeedQFunctionContextSetData(ctx_r, CEED_MEM_HOST, CEED_OWN_POINTER, sizeof(*num_comp_r_data), num_comp_r_data));
-    CeedCall(CeedQFunctionSetContext(qf_restrict, ctx_r));
-    CeedCall(CeedQFunctionContextDestroy(&ctx_r));
-    CeedCall(CeedQFunctionAddInput(qf_restrict, "input", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionAddInput(qf_restrict, "scale", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionAddOutput(qf_restrict, "output", num_comp, CEED_EVAL_INTERP));
-    CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_restrict, num_comp));
+    CeedQFunction qf_restrict = NULL;
 
+    if (qf_restrict_in) CeedCall(CeedQFunctionReferenceCopy(qf_restrict_in, &qf_restrict));
+    else CeedCall(CeedQFunctionCreateMultigridScale(ceed, num_comp, false, &qf_restrict));
     CeedCall(CeedOperatorCreate(ceed, qf_restrict, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, op_restrict));
     CeedCall(CeedOperatorSetField(*op_restrict, "input", rstr_fine, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE));
     CeedCall(CeedOperatorSetField(*op_restrict, "scale", rstr_p_mult_fine, CEED_BASIS_NONE, mult_vec));
@@ -991,22 +1633,10 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
 
   // Prolongation
   if (op_prolong) {
-    CeedInt             *num_comp_p_data;
-    CeedQFunctionContext ctx_p;
-    CeedQFunction        qf_prolong;
-
-    CeedCall(CeedQFunctionCreateInteriorByName(ceed, "Scale", &qf_prolong));
-    CeedCall(CeedCalloc(1, &num_comp_p_data));
-    num_comp_p_data[0] = num_comp;
-    CeedCall(CeedQFunctionContextCreate(ceed, &ctx_p));
-    CeedCall(CeedQFunctionContextSetData(ctx_p, CEED_MEM_HOST, CEED_OWN_POINTER, sizeof(*num_comp_p_data), num_comp_p_data));
-    CeedCall(CeedQFunctionSetContext(qf_prolong, ctx_p));
-    CeedCall(CeedQFunctionContextDestroy(&ctx_p));
-    CeedCall(CeedQFunctionAddInput(qf_prolong, "input", num_comp, CEED_EVAL_INTERP));
-    CeedCall(CeedQFunctionAddInput(qf_prolong, "scale", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionAddOutput(qf_prolong, "output", num_comp, CEED_EVAL_NONE));
-    CeedCall(CeedQFunctionSetUserFlopsEstimate(qf_prolong, num_comp));
+    CeedQFunction qf_prolong = NULL;
 
+    if (qf_prolong_in) CeedCall(CeedQFunctionReferenceCopy(qf_prolong_in, &qf_prolong));
+    else CeedCall(CeedQFunctionCreateMultigridScale(ceed, num_comp, true, &qf_prolong));
     CeedCall(CeedOperatorCreate(ceed, qf_prolong, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, op_prolong));
     CeedCall(CeedOperatorSetField(*op_prolong, "input", rstr_coarse, basis_c_to_f, CEED_VECTOR_ACTIVE));
     CeedCall(CeedOperatorSetField(*op_prolong, "scale", rstr_p_mult_fine, CEED_BASIS_NONE, mult_vec));
@@ -1079,6 +1709,67 @@ static int CeedBuildMassLaplace(const CeedScalar *interp_1d, const CeedScalar *g
 }
 CeedPragmaOptimizeOn
 
+/**
+  @brief Get the 1D fast diagonalization of a tensor `CeedBasis`, computing and storing it in the `CeedBasis` on first use
+
+  The simultaneous diagonalization of the 1D mass and perturbed Laplacian, \f$M = V^T V, K = V^T S V\f$, depends only on the `CeedBasis`, so repeated calls to @ref CeedOperatorCreateFDMElementInverse() for operators sharing an active `CeedBasis` reuse it.
+
+  @param[in]  ceed      `Ceed` object used to create the eigenvector `CeedBasis`
+  @param[in]  basis     Tensor product `CeedBasis` to diagonalize
+  @param[out] basis_fdm `CeedBasis` interpolating from nodes to eigenvector coefficients, owned by `basis`
+  @param[out] lambda    Array of `P_1d` eigenvalues, owned by `basis`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisGetFDMDiagonalization(Ceed ceed, CeedBasis basis, CeedBasis *basis_fdm, const CeedScalar **lambda) {
+  if (!basis->basis_fdm) {
+    CeedInt           dim, num_comp, P_1d, Q_1d;
+    CeedScalar       *mass, *laplace, *x, *fdm_interp, *grad_dummy, *q_ref_dummy, *q_weight_dummy;
+    const CeedScalar *interp_1d, *grad_1d, *q_weight_1d;
+
+    CeedCall(CeedBasisGetDimension(basis, &dim));
+    CeedCall(CeedBasisGetNumComponents(basis, &num_comp));
+    CeedCall(CeedBasisGetNumNodes1D(basis, &P_1d));
+    CeedCall(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+
+    // Build and diagonalize 1D Mass and Laplacian
+    CeedCall(CeedCalloc(P_1d * P_1d, &mass));
+    CeedCall(CeedCalloc(P_1d * P_1d, &laplace));
+    CeedCall(CeedCalloc(P_1d * P_1d, &x));
+    CeedCall(CeedCalloc(P_1d * P_1d, &fdm_interp));
+    CeedCall(CeedCalloc(P_1d, &basis->fdm_lambda_1d));
+    // -- Build matrices
+    CeedCall(CeedBasisGetInterp1D(basis, &interp_1d));
+    CeedCall(CeedBasisGetGrad1D(basis, &grad_1d));
+    CeedCall(CeedBasisGetQWeights(basis, &q_weight_1d));
+    CeedCall(CeedBuildMassLaplace(interp_1d, grad_1d, q_weight_1d, P_1d, Q_1d, dim, mass, laplace));
+
+    // -- Diagonalize
+    CeedCall(CeedSimultaneousDiagonalization(ceed, laplace, mass, x, basis->fdm_lambda_1d, P_1d));
+    CeedCall(CeedFree(&mass));
+    CeedCall(CeedFree(&laplace));
+    for (CeedInt i = 0; i < P_1d; i++) {
+      for (CeedInt j = 0; j < P_1d; j++) fdm_interp[i + j * P_1d] = x[j + i * P_1d];
+    }
+    CeedCall(CeedFree(&x));
+
+    // -- Eigenvector basis
+    CeedCall(CeedCalloc(P_1d * P_1d, &grad_dummy));
+    CeedCall(CeedCalloc(P_1d, &q_ref_dummy));
+    CeedCall(CeedCalloc(P_1d, &q_weight_dummy));
+    CeedCall(CeedBasisCreateTensorH1(ceed, dim, num_comp, P_1d, P_1d, fdm_interp, grad_dummy, q_ref_dummy, q_weight_dummy, &basis->basis_fdm));
+    CeedCall(CeedFree(&fdm_interp));
+    CeedCall(CeedFree(&grad_dummy));
+    CeedCall(CeedFree(&q_ref_dummy));
+    CeedCall(CeedFree(&q_weight_dummy));
+  }
+  *basis_fdm = basis->basis_fdm;
+  *lambda    = basis->fdm_lambda_1d;
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -1162,6 +1853,41 @@ int CeedOperatorCreateActivePointBlockRestriction(CeedElemRestriction rstr, Ceed
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Sum into a `CeedVector` the diagonal or point block diagonal of a non-composite linear `CeedOperator`, assembling the `CeedQFunction` one block of elements at a time.
+
+  `assemble_block` evaluates the linearized `CeedQFunction` for the `num_elem_block` elements starting at `e_start` into an array holding a single block, laid out with the strides in `layout_block`.
+  Only one block is stored at a time, rather than the assembled `CeedQFunction` for the whole mesh.
+  If `CeedQFunction` assembly reuse has been set with @ref CeedOperatorSetQFunctionAssemblyReuse(), the stored assembled `CeedQFunction` is used instead and `assemble_block` is not called.
+
+  @param[in]  op             `CeedOperator` to assemble diagonal or point block diagonal
+  @param[in]  block_size     Number of elements in each block
+  @param[in]  layout_block   Strides between quadrature points, `CeedQFunction` matrix entries, and elements in the array filled by `assemble_block`
+  @param[in]  assemble_block Function to assemble the `CeedQFunction` for a block of elements
+  @param[in]  ctx            Context data passed to `assemble_block`
+  @param[in]  is_point_block Boolean flag to assemble diagonal or point block diagonal
+  @param[out] assembled      `CeedVector` to store assembled diagonal
+  @param[in]  request        Address of @ref CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorLinearAssembleAddDiagonalByBlock(CeedOperator op, CeedInt block_size, const CeedInt layout_block[3],
+                                                 CeedOperatorLinearAssembleQFunctionBlock assemble_block, void *ctx, bool is_point_block,
+                                                 CeedVector assembled, CeedRequest *request) {
+  CeedQFunctionAssemblyData data;
+
+  CeedCall(CeedOperatorGetQFunctionAssemblyData(op, &data));
+  if (data->reuse_data) {
+    CeedCall(CeedSingleOperatorLinearAssembleAddDiagonal_Mesh(op, request, is_point_block, assembled));
+  } else {
+    CeedCall(CeedSingleOperatorLinearAssembleAddDiagonal_Core(op, NULL, layout_block, block_size, assemble_block, ctx, request, is_point_block,
+                                                              assembled));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get `CeedQFunctionAssemblyData`
 
@@ -1432,7 +2158,15 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
 
       CeedCall(CeedOperatorFieldGetBasis(op_fields[i], &basis_in));
       CeedCall(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
-      CeedCall(CeedBasisGetNumComponents(basis_in, &num_comp));
+      if (basis_in == CEED_BASIS_NONE) {
+        CeedElemRestriction elem_rstr;
+
+        CeedCall(CeedOperatorFieldGetElemRestriction(op_fields[i], &elem_rstr));
+        CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+        CeedCall(CeedElemRestrictionDestroy(&elem_rstr));
+      } else {
+        CeedCall(CeedBasisGetNumComponents(basis_in, &num_comp));
+      }
       CeedCall(CeedBasisGetNumQuadratureComponents(basis_in, eval_mode, &q_comp));
       for (CeedInt i = 0; i < num_active_bases_in; i++) {
         if ((*data)->active_bases_in[i] == basis_in) index = i;
@@ -1475,6 +2209,8 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
     CeedCall(CeedVectorDestroy(&vec));
   }
 
+  (*data)->num_input_components = offset;
+
   // Determine active output basis
   CeedCall(CeedQFunctionGetFields(qf, NULL, NULL, &num_output_fields, &qf_fields));
   CeedCall(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
@@ -1490,7 +2226,15 @@ int CeedOperatorAssemblyDataCreate(Ceed ceed, CeedOperator op, CeedOperatorAssem
 
       CeedCall(CeedOperatorFieldGetBasis(op_fields[i], &basis_out));
       CeedCall(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
-      CeedCall(CeedBasisGetNumComponents(basis_out, &num_comp));
+      if (basis_out == CEED_BASIS_NONE) {
+        CeedElemRestriction elem_rstr;
+
+        CeedCall(CeedOperatorFieldGetElemRestriction(op_fields[i], &elem_rstr));
+        CeedCall(CeedElemRestrictionGetNumComponents(elem_rstr, &num_comp));
+        CeedCall(CeedElemRestrictionDestroy(&elem_rstr));
+      } else {
+        CeedCall(CeedBasisGetNumComponents(basis_out, &num_comp));
+      }
       CeedCall(CeedBasisGetNumQuadratureComponents(basis_out, eval_mode, &q_comp));
       for (CeedInt i = 0; i < num_active_bases_out; i++) {
         if ((*data)->active_bases_out[i] == basis_out) index = i;
@@ -1774,11 +2518,69 @@ int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data) {
   CeedCall(CeedFree(&(*data)->eval_mode_offsets_out));
   CeedCall(CeedFree(&(*data)->assembled_bases_in));
   CeedCall(CeedFree(&(*data)->assembled_bases_out));
+  CeedCall(CeedFree(&(*data)->qf_is_nonzero));
 
   CeedCall(CeedFree(data));
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the stored element matrices of a non-composite `CeedOperator` for application with @ref CeedOperatorSetElementMatrixApply()
+
+  The element matrices are assembled as in @ref CeedOperatorLinearAssemble() on first use, after a passive input `CeedVector` or the `CeedQFunctionContext` data is written, and after @ref CeedOperatorSetQFunctionAssemblyDataUpdateNeeded().
+  Element `e` stores the `elem_size_out x elem_size_in` row-major block for input component `comp_in` and output component `comp_out` at offset `((e * num_comp_in + comp_in) * num_comp_out + comp_out) * elem_size_out * elem_size_in`.
+  The returned `CeedElemRestriction` are unoriented copies of the active `CeedElemRestriction`, as the element matrices include any orientation transforms.
+
+  Note: Caller is responsible for destroying the `rstr_in` and `rstr_out` with @ref CeedElemRestrictionDestroy().
+        The `elem_mats` array is owned by the `CeedOperator` and is valid until the next call to this function.
+
+  @param[in]  op        `CeedOperator` to get element matrices for
+  @param[out] rstr_in   Variable to store unoriented active input `CeedElemRestriction`
+  @param[out] rstr_out  Variable to store unoriented active output `CeedElemRestriction`
+  @param[out] elem_mats Variable to store element matrices
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorGetElementMatrices(CeedOperator op, CeedElemRestriction *rstr_in, CeedElemRestriction *rstr_out, const CeedScalar **elem_mats) {
+  // Update element matrices, if needed
+  {
+    bool     is_update_needed = !op->elem_mats || (op->qf_assembled && op->qf_assembled->needs_data_update);
+    uint64_t passive_state;
+
+    CeedCall(CeedOperatorGetPassiveInputState(op, &passive_state));
+    if (is_update_needed || passive_state != op->elem_mats_passive_state) {
+      CeedCall(CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(op, true));
+      CeedCall(CeedSingleOperatorAssemble(op, 0, NULL, NULL));
+      // Assembly may write to the context data, so record the state afterwards
+      CeedCall(CeedOperatorGetPassiveInputState(op, &op->elem_mats_passive_state));
+    }
+  }
+
+  // Unoriented active restrictions
+  if (!op->elem_mat_rstr_in) {
+    CeedElemRestriction active_rstr_in, active_rstr_out;
+
+    CeedCall(CeedOperatorGetActiveElemRestrictions(op, &active_rstr_in, &active_rstr_out));
+    CeedCall(CeedElemRestrictionCreateUnorientedCopy(active_rstr_in, &op->elem_mat_rstr_in));
+    if (active_rstr_in == active_rstr_out) CeedCall(CeedElemRestrictionReferenceCopy(op->elem_mat_rstr_in, &op->elem_mat_rstr_out));
+    else CeedCall(CeedElemRestrictionCreateUnorientedCopy(active_rstr_out, &op->elem_mat_rstr_out));
+    CeedCall(CeedElemRestrictionDestroy(&active_rstr_in));
+    CeedCall(CeedElemRestrictionDestroy(&active_rstr_out));
+  }
+  if (rstr_in) {
+    *rstr_in = NULL;
+    CeedCall(CeedElemRestrictionReferenceCopy(op->elem_mat_rstr_in, rstr_in));
+  }
+  if (rstr_out) {
+    *rstr_out = NULL;
+    CeedCall(CeedElemRestrictionReferenceCopy(op->elem_mat_rstr_out, rstr_out));
+  }
+  *elem_mats = op->elem_mats;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Retrieve fallback `CeedOperator` with a reference `Ceed` for advanced `CeedOperator` functionality
 
@@ -2329,8 +3131,10 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
    Expected to be used in conjunction with @ref CeedOperatorLinearAssemble().
 
    The assembly routines use coordinate format, with `num_entries` tuples of the form `(i, j, value)` which indicate that value should be added to the matrix in entry `(i, j)`.
-   Note that the `(i, j)` pairs are not unique and may repeat.
+   Note that the `(i, j)` pairs are not unique and may repeat; use @ref CeedOperatorLinearAssembleSymbolicCSR() to merge repeated pairs.
    This function returns the number of entries and their `(i, j)` locations, while @ref CeedOperatorLinearAssemble() provides the values in the same ordering.
+   The entries for each sub-operator of a composite `CeedOperator` are stored contiguously, in the order the sub-operators were added.
+   Use @ref CeedOperatorLinearAssembleSymbolic64() if the active vectors have more than `2^31 - 1` entries.
 
    This will generally be slow unless your operator is low-order.
 
@@ -2344,13 +3148,7 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
    @ref User
 **/
 int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, CeedInt **rows, CeedInt **cols) {
-  bool          is_composite;
-  CeedInt       num_suboperators, offset = 0;
-  CeedSize      single_entries;
-  CeedOperator *sub_operators;
-
   CeedCall(CeedOperatorCheckReady(op));
-  CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
   if (op->LinearAssembleSymbolic) {
     // Backend version
@@ -2368,35 +3166,54 @@ int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, C
   }
 
   // Default interface implementation
+  CeedCall(CeedOperatorAssembleSymbolic(op, num_entries, rows, cols, NULL, NULL));
+  return CEED_ERROR_SUCCESS;
+}
 
-  // Count entries and allocate rows, cols arrays
-  *num_entries = 0;
-  if (is_composite) {
-    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
-    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
-    for (CeedInt k = 0; k < num_suboperators; ++k) {
-      CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
-      *num_entries += single_entries;
+/**
+   @brief Fully assemble the nonzero pattern of a linear operator with `CeedSize` indices.
+
+   This function is identical to @ref CeedOperatorLinearAssembleSymbolic(), but returns `CeedSize` row and column numbers, for active vectors with more than `2^31 - 1` entries.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op          `CeedOperator` to assemble
+   @param[out] num_entries Number of entries in coordinate nonzero pattern
+   @param[out] rows        Row number for each entry
+   @param[out] cols        Column number for each entry
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleSymbolic64(CeedOperator op, CeedSize *num_entries, CeedSize **rows, CeedSize **cols) {
+  CeedCall(CeedOperatorCheckReady(op));
+
+  if (op->LinearAssembleSymbolic) {
+    // Backend version, with CeedInt indices
+    CeedInt *rows_backend, *cols_backend;
+
+    CeedCall(op->LinearAssembleSymbolic(op, num_entries, &rows_backend, &cols_backend));
+    CeedCall(CeedCalloc(*num_entries, rows));
+    CeedCall(CeedCalloc(*num_entries, cols));
+    for (CeedSize k = 0; k < *num_entries; k++) {
+      (*rows)[k] = rows_backend[k];
+      (*cols)[k] = cols_backend[k];
     }
+    CeedCall(CeedFree(&rows_backend));
+    CeedCall(CeedFree(&cols_backend));
+    return CEED_ERROR_SUCCESS;
   } else {
-    CeedCall(CeedSingleOperatorAssemblyCountEntries(op, &single_entries));
-    *num_entries += single_entries;
-  }
-  CeedCall(CeedCalloc(*num_entries, rows));
-  CeedCall(CeedCalloc(*num_entries, cols));
+    // Operator fallback
+    CeedOperator op_fallback;
 
-  // Assemble nonzero locations
-  if (is_composite) {
-    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
-    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
-    for (CeedInt k = 0; k < num_suboperators; ++k) {
-      CeedCall(CeedSingleOperatorAssembleSymbolic(sub_operators[k], offset, *rows, *cols));
-      CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
-      offset += single_entries;
+    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    if (op_fallback) {
+      CeedCall(CeedOperatorLinearAssembleSymbolic64(op_fallback, num_entries, rows, cols));
+      return CEED_ERROR_SUCCESS;
     }
-  } else {
-    CeedCall(CeedSingleOperatorAssembleSymbolic(op, offset, *rows, *cols));
   }
+
+  // Default interface implementation
+  CeedCall(CeedOperatorAssembleSymbolic(op, num_entries, NULL, NULL, rows, cols));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2420,8 +3237,8 @@ int CeedOperatorLinearAssembleSymbolic(CeedOperator op, CeedSize *num_entries, C
 **/
 int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
   bool          is_composite;
-  CeedInt       num_suboperators, offset = 0;
-  CeedSize      single_entries = 0;
+  CeedInt       num_suboperators;
+  CeedSize      single_entries = 0, offset = 0;
   CeedOperator *sub_operators;
 
   CeedCall(CeedOperatorCheckReady(op));
@@ -2456,12 +3273,146 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
     CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
     CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
     for (CeedInt k = 0; k < num_suboperators; k++) {
-      CeedCall(CeedSingleOperatorAssemble(sub_operators[k], offset, values));
+      CeedCall(CeedSingleOperatorAssemble(sub_operators[k], offset, NULL, values));
+      CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
+      offset += single_entries;
+    }
+  } else {
+    CeedCall(CeedSingleOperatorAssemble(op, offset, NULL, values));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Fully assemble the compressed sparse row nonzero pattern of a linear `CeedOperator`.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleCSR().
+
+   The coordinate entries from @ref CeedOperatorLinearAssembleSymbolic() are sorted by row and column and repeated `(i, j)` pairs are merged.
+   The nonzeros in row `i` are stored in `[row_ptr[i], row_ptr[i + 1])`, with increasing column indices in `col_idx`.
+   `row_ptr` has one more entry than the length of the active output vector.
+   The map from coordinate entries to nonzeros is stored in the `CeedOperator`, so @ref CeedOperatorLinearAssembleCSR() can accumulate element matrices directly into the nonzero values.
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op           `CeedOperator` to assemble
+   @param[out] num_nonzeros Number of nonzeros in compressed sparse row pattern
+   @param[out] row_ptr      Offset of first nonzero for each row, followed by `num_nonzeros`
+   @param[out] col_idx      Column number for each nonzero
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleSymbolicCSR(CeedOperator op, CeedSize *num_nonzeros, CeedInt **row_ptr, CeedInt **col_idx) {
+  CeedSize num_entries, num_rows, num_cols, num_slots = 0;
+  CeedInt *rows, *cols, *col_ptr, *order_by_col, *order, *csr_map;
+
+  // Coordinate pattern
+  CeedCall(CeedOperatorLinearAssembleSymbolic(op, &num_entries, &rows, &cols));
+  CeedCall(CeedOperatorGetActiveVectorLengths(op, &num_cols, &num_rows));
+  CeedCheck(num_entries <= INT32_MAX, CeedOperatorReturnCeed(op), CEED_ERROR_UNSUPPORTED,
+            "Compressed sparse row assembly requires fewer than 2^31 coordinate entries");
+
+  // Sort entries by column, then stable sort by row
+  CeedCall(CeedCalloc(num_cols + 1, &col_ptr));
+  CeedCall(CeedCalloc(num_rows + 1, row_ptr));
+  CeedCall(CeedCalloc(num_entries, &order_by_col));
+  CeedCall(CeedCalloc(num_entries, &order));
+  for (CeedSize k = 0; k < num_entries; k++) {
+    col_ptr[cols[k] + 1]++;
+    (*row_ptr)[rows[k] + 1]++;
+  }
+  for (CeedSize j = 0; j < num_cols; j++) col_ptr[j + 1] += col_ptr[j];
+  for (CeedSize i = 0; i < num_rows; i++) (*row_ptr)[i + 1] += (*row_ptr)[i];
+  for (CeedSize k = 0; k < num_entries; k++) order_by_col[col_ptr[cols[k]]++] = k;
+  for (CeedSize k = 0; k < num_entries; k++) order[(*row_ptr)[rows[order_by_col[k]]]++] = order_by_col[k];
+
+  // Merge repeated entries in each row
+  CeedCall(CeedCalloc(num_entries, &csr_map));
+  CeedCall(CeedCalloc(num_entries, col_idx));
+  for (CeedSize i = 0, k = 0; i < num_rows; i++) {
+    const CeedSize row_start = num_slots;
+
+    for (; k < (*row_ptr)[i]; k++) {
+      const CeedInt col = cols[order[k]];
+
+      if (num_slots == row_start || (*col_idx)[num_slots - 1] != col) (*col_idx)[num_slots++] = col;
+      csr_map[order[k]] = num_slots - 1;
+    }
+    (*row_ptr)[i] = row_start;
+  }
+  (*row_ptr)[num_rows] = num_slots;
+  CeedCall(CeedRealloc(num_slots, col_idx));
+  *num_nonzeros = num_slots;
+
+  // Store map for numeric assembly
+  CeedCall(CeedFree(&op->csr_map));
+  op->csr_map          = csr_map;
+  op->csr_num_entries  = num_entries;
+  op->csr_num_nonzeros = num_slots;
+
+  CeedCall(CeedFree(&rows));
+  CeedCall(CeedFree(&cols));
+  CeedCall(CeedFree(&col_ptr));
+  CeedCall(CeedFree(&order_by_col));
+  CeedCall(CeedFree(&order));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+   @brief Fully assemble the compressed sparse row nonzero values of a linear `CeedOperator`.
+
+   Expected to be used in conjunction with @ref CeedOperatorLinearAssembleSymbolicCSR().
+
+   Element matrices are accumulated directly into the nonzero values, without sorting or repeated coordinate entries.
+   This function may be called repeatedly, e.g. within a Newton iteration, after a single call to @ref CeedOperatorLinearAssembleSymbolicCSR().
+
+   Note: Calling this function asserts that setup is complete and sets the `CeedOperator` as immutable.
+
+   @param[in]  op     `CeedOperator` to assemble
+   @param[out] values Values of the nonzeros, in the order of `col_idx` from @ref CeedOperatorLinearAssembleSymbolicCSR()
+
+   @ref User
+**/
+int CeedOperatorLinearAssembleCSR(CeedOperator op, CeedVector values) {
+  bool     is_composite;
+  CeedSize length, single_entries, offset = 0;
+  Ceed     ceed;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorGetCeed(op, &ceed));
+  CeedCall(CeedOperatorIsComposite(op, &is_composite));
+  CeedCheck(op->csr_map, ceed, CEED_ERROR_INCOMPLETE, "Must call CeedOperatorLinearAssembleSymbolicCSR before CeedOperatorLinearAssembleCSR");
+  CeedCall(CeedVectorGetLength(values, &length));
+  CeedCheck(length == op->csr_num_nonzeros, ceed, CEED_ERROR_DIMENSION,
+            "Values vector has length %" CeedSize_FMT ", but the compressed sparse row pattern has %" CeedSize_FMT " nonzeros", length,
+            op->csr_num_nonzeros);
+  CeedCall(CeedVectorSetValue(values, 0.0));
+
+  // Backend version of coordinate assembly
+  if (op->LinearAssemble) {
+    CeedVector coo_values;
+
+    CeedCall(CeedVectorCreate(ceed, op->csr_num_entries, &coo_values));
+    CeedCall(CeedOperatorLinearAssemble(op, coo_values));
+    CeedCall(CeedOperatorAssemblyAddCOOToCSR(coo_values, op->csr_map, values));
+    CeedCall(CeedVectorDestroy(&coo_values));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Accumulate element matrices
+  if (is_composite) {
+    CeedInt       num_suboperators;
+    CeedOperator *sub_operators;
+
+    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+    for (CeedInt k = 0; k < num_suboperators; k++) {
+      CeedCall(CeedSingleOperatorAssemble(sub_operators[k], offset, op->csr_map, values));
       CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
       offset += single_entries;
     }
   } else {
-    CeedCall(CeedSingleOperatorAssemble(op, offset, values));
+    CeedCall(CeedSingleOperatorAssemble(op, offset, op->csr_map, values));
   }
   return CEED_ERROR_SUCCESS;
 }
@@ -2573,7 +3524,8 @@ int CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fin
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, NULL, NULL, op_coarse, op_prolong,
+                                            op_restrict));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2638,7 +3590,8 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine, CeedVector p_
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, NULL, NULL, op_coarse, op_prolong,
+                                            op_restrict));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2701,7 +3654,87 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, NULL, NULL, op_coarse, op_prolong,
+                                            op_restrict));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Create a hierarchy of multigrid coarse `CeedOperator` and level transfer `CeedOperator` for a `CeedOperator`, creating the prolongation bases from the interpolation of consecutive levels.
+
+  Level `i` coarsens `op_fine` for `i = 0` and `op_coarse[i - 1]` otherwise, so `rstr_coarse` and `basis_coarse` are ordered from finest to coarsest.
+  The scaling `CeedQFunction` are shared by the level transfer `CeedOperator` on every level, and the projections between bases are reused from the projection cache when the same spaces have been projected before.
+
+  Note: Calling this function asserts that setup is complete and sets all created `CeedOperator` as immutable.
+
+  @param[in]  op_fine      Fine grid `CeedOperator`
+  @param[in]  num_levels   Number of coarse levels to create
+  @param[in]  p_mult       Array of L-vector multiplicity in parallel gather/scatter for the fine side of each level, or `NULL` for unit multiplicity on every level
+  @param[in]  rstr_coarse  Array of coarse grid `CeedElemRestriction` for each level
+  @param[in]  basis_coarse Array of coarse grid active vector `CeedBasis` for each level
+  @param[out] op_coarse    Array of coarse grid `CeedOperator` for each level
+  @param[out] op_prolong   Array of coarse to fine `CeedOperator` for each level, or `NULL`
+  @param[out] op_restrict  Array of fine to coarse `CeedOperator` for each level, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorMultigridHierarchyCreate(CeedOperator op_fine, CeedInt num_levels, CeedVector *p_mult, CeedElemRestriction *rstr_coarse,
+                                         CeedBasis *basis_coarse, CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict) {
+  Ceed          ceed;
+  CeedInt       num_comp;
+  CeedQFunction qf_prolong = NULL, qf_restrict = NULL;
+
+  CeedCall(CeedOperatorCheckReady(op_fine));
+  CeedCall(CeedOperatorGetCeed(op_fine, &ceed));
+  CeedCheck(num_levels > 0, ceed, CEED_ERROR_DIMENSION, "Multigrid hierarchy requires at least one coarse level");
+
+  // Scaling QFunctions shared by all levels
+  CeedCall(CeedBasisGetNumComponents(basis_coarse[0], &num_comp));
+  if (op_prolong) CeedCall(CeedQFunctionCreateMultigridScale(ceed, num_comp, true, &qf_prolong));
+  if (op_restrict) CeedCall(CeedQFunctionCreateMultigridScale(ceed, num_comp, false, &qf_restrict));
+
+  // Create levels
+  for (CeedInt i = 0; i < num_levels; i++) {
+    CeedInt      num_comp_level;
+    CeedVector   p_mult_level = NULL;
+    CeedBasis    basis_c_to_f = NULL;
+    CeedOperator op_level     = i == 0 ? op_fine : op_coarse[i - 1];
+
+    CeedCall(CeedBasisGetNumComponents(basis_coarse[i], &num_comp_level));
+    CeedCheck(num_comp_level == num_comp, ceed, CEED_ERROR_DIMENSION,
+              "Coarse bases must have the same number of components, level 0 has %" CeedInt_FMT " and level %" CeedInt_FMT " has %" CeedInt_FMT,
+              num_comp, i, num_comp_level);
+
+    // Prolongation basis and multiplicity, if required
+    if (op_prolong || op_restrict) {
+      CeedBasis basis_fine;
+
+      CeedCall(CeedOperatorGetActiveBasis(op_level, &basis_fine));
+      CeedCall(CeedBasisCreateProjection(basis_coarse[i], basis_fine, &basis_c_to_f));
+      CeedCall(CeedBasisDestroy(&basis_fine));
+      if (p_mult) {
+        CeedCall(CeedVectorReferenceCopy(p_mult[i], &p_mult_level));
+      } else {
+        CeedElemRestriction rstr_fine;
+
+        CeedCall(CeedOperatorGetActiveElemRestriction(op_level, &rstr_fine));
+        CeedCall(CeedElemRestrictionCreateVector(rstr_fine, &p_mult_level, NULL));
+        CeedCall(CeedVectorSetValue(p_mult_level, 1.0));
+        CeedCall(CeedElemRestrictionDestroy(&rstr_fine));
+      }
+    }
+
+    // Core code
+    CeedCall(CeedSingleOperatorMultigridLevel(op_level, p_mult_level, rstr_coarse[i], basis_coarse[i], basis_c_to_f, qf_prolong, qf_restrict,
+                                              &op_coarse[i], op_prolong ? &op_prolong[i] : NULL, op_restrict ? &op_restrict[i] : NULL));
+    CeedCall(CeedVectorDestroy(&p_mult_level));
+  }
+
+  // Cleanup
+  CeedCall(CeedQFunctionDestroy(&qf_prolong));
+  CeedCall(CeedQFunctionDestroy(&qf_restrict));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2711,6 +3744,7 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   This returns a `CeedOperator` and `CeedVector` to apply a Fast Diagonalization Method based approximate inverse.
   This function obtains the simultaneous diagonalization for the 1D mass and Laplacian operators, \f$M = V^T V, K = V^T S V\f$.
   The assembled `CeedQFunction` is used to modify the eigenvalues from simultaneous diagonalization and obtain an approximate inverse of the form \f$V^T \hat S V\f$.
+  In the `/cpu/self` backends, the returned `CeedOperator` is applied with one fused pass per block of elements using the tensor contraction kernels of the backend, also as a sub-operator of a composite `CeedOperator`; other backends apply it with the scaling `CeedQFunction`.
   The `CeedOperator` must be linear and non-composite.
   The associated `CeedQFunction` must therefore also be linear.
 
@@ -2727,9 +3761,9 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
 int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request) {
   Ceed                 ceed, ceed_parent;
   bool                 interp = false, grad = false, is_tensor_basis = true;
-  CeedInt              num_input_fields, P_1d, Q_1d, num_nodes, num_qpts, dim, num_comp = 1, num_elem = 1;
-  CeedScalar          *mass, *laplace, *x, *fdm_interp, *lambda, *elem_avg;
-  const CeedScalar    *interp_1d, *grad_1d, *q_weight_1d;
+  CeedInt              num_input_fields, P_1d, num_nodes, num_qpts, dim, num_comp = 1, num_elem = 1;
+  CeedScalar          *elem_avg;
+  const CeedScalar    *lambda;
   CeedVector           q_data;
   CeedElemRestriction  rstr  = NULL, rstr_qd_i;
   CeedBasis            basis = NULL, fdm_basis;
@@ -2781,38 +3815,23 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedCheck(basis, ceed, CEED_ERROR_BACKEND, "No active field set");
   CeedCall(CeedBasisGetNumNodes1D(basis, &P_1d));
   CeedCall(CeedBasisGetNumNodes(basis, &num_nodes));
-  CeedCall(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
   CeedCall(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
   CeedCall(CeedBasisGetDimension(basis, &dim));
   CeedCall(CeedBasisGetNumComponents(basis, &num_comp));
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
+#ifdef _OPENMP
+  // Setup loops over elements are split across threads unless already in a parallel region
+  const int num_threads = omp_in_parallel() ? 1 : CeedIntMax(1, CeedIntMin(omp_get_max_threads(), num_elem));
+#endif
 
-  // Build and diagonalize 1D Mass and Laplacian
+  // Diagonalize 1D Mass and Laplacian
   CeedCall(CeedBasisIsTensor(basis, &is_tensor_basis));
   CeedCheck(is_tensor_basis, ceed, CEED_ERROR_BACKEND, "FDMElementInverse only supported for tensor bases");
-  CeedCall(CeedCalloc(P_1d * P_1d, &mass));
-  CeedCall(CeedCalloc(P_1d * P_1d, &laplace));
-  CeedCall(CeedCalloc(P_1d * P_1d, &x));
-  CeedCall(CeedCalloc(P_1d * P_1d, &fdm_interp));
-  CeedCall(CeedCalloc(P_1d, &lambda));
-  // -- Build matrices
-  CeedCall(CeedBasisGetInterp1D(basis, &interp_1d));
-  CeedCall(CeedBasisGetGrad1D(basis, &grad_1d));
-  CeedCall(CeedBasisGetQWeights(basis, &q_weight_1d));
-  CeedCall(CeedBuildMassLaplace(interp_1d, grad_1d, q_weight_1d, P_1d, Q_1d, dim, mass, laplace));
-
-  // -- Diagonalize
-  CeedCall(CeedSimultaneousDiagonalization(ceed, laplace, mass, x, lambda, P_1d));
-  CeedCall(CeedFree(&mass));
-  CeedCall(CeedFree(&laplace));
-  for (CeedInt i = 0; i < P_1d; i++) {
-    for (CeedInt j = 0; j < P_1d; j++) fdm_interp[i + j * P_1d] = x[j + i * P_1d];
-  }
-  CeedCall(CeedFree(&x));
+  CeedCall(CeedBasisGetFDMDiagonalization(ceed_parent, basis, &fdm_basis, &lambda));
 
   {
     CeedInt             layout[3], num_modes = (interp ? 1 : 0) + (grad ? dim : 0);
-    CeedScalar          max_norm = 0;
+    CeedScalar          max_norm = 0, *q_weight_inv;
     const CeedScalar   *assembled_array, *q_weight_array;
     CeedVector          assembled = NULL, q_weight;
     CeedElemRestriction rstr_qf   = NULL;
@@ -2828,26 +3847,31 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
     CeedCall(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_weight));
     CeedCall(CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array));
     CeedCall(CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array));
+    CeedCall(CeedCalloc(num_qpts, &q_weight_inv));
+    for (CeedInt q = 0; q < num_qpts; q++) q_weight_inv[q] = 1.0 / q_weight_array[q];
     CeedCall(CeedCalloc(num_elem, &elem_avg));
+    const CeedInt    num_entries    = num_comp * num_comp * num_modes * num_modes;
     const CeedScalar qf_value_bound = max_norm * 100 * CEED_EPSILON;
 
+    // -- Entries of each element are read contiguously along quadrature points
+    CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
     for (CeedInt e = 0; e < num_elem; e++) {
-      CeedInt count = 0;
+      CeedInt    count = 0;
+      CeedScalar sum   = 0.0;
 
-      for (CeedInt q = 0; q < num_qpts; q++) {
-        for (CeedInt i = 0; i < num_comp * num_comp * num_modes * num_modes; i++) {
-          if (fabs(assembled_array[q * layout[0] + i * layout[1] + e * layout[2]]) > qf_value_bound) {
-            elem_avg[e] += assembled_array[q * layout[0] + i * layout[1] + e * layout[2]] / q_weight_array[q];
-            count++;
-          }
+      for (CeedInt i = 0; i < num_entries; i++) {
+        const CeedScalar *values = &assembled_array[i * layout[1] + e * layout[2]];
+
+        for (CeedInt q = 0; q < num_qpts; q++) {
+          const bool is_nonzero = fabs(values[q * layout[0]]) > qf_value_bound;
+
+          sum += is_nonzero ? values[q * layout[0]] * q_weight_inv[q] : 0.0;
+          count += is_nonzero;
         }
       }
-      if (count) {
-        elem_avg[e] /= count;
-      } else {
-        elem_avg[e] = 1.0;
-      }
+      elem_avg[e] = count ? sum / count : 1.0;
     }
+    CeedCall(CeedFree(&q_weight_inv));
     CeedCall(CeedVectorRestoreArrayRead(assembled, &assembled_array));
     CeedCall(CeedVectorDestroy(&assembled));
     CeedCall(CeedVectorRestoreArrayRead(q_weight, &q_weight_array));
@@ -2856,53 +3880,40 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
 
   // Build FDM diagonal
   {
-    CeedScalar *q_data_array, *fdm_diagonal;
+    CeedScalar *q_data_array, *fdm_diagonal_inv;
 
-    CeedCall(CeedCalloc(num_comp * num_nodes, &fdm_diagonal));
+    CeedCall(CeedCalloc(num_comp * num_nodes, &fdm_diagonal_inv));
     const CeedScalar fdm_diagonal_bound = num_nodes * CEED_EPSILON;
     for (CeedInt c = 0; c < num_comp; c++) {
       for (CeedInt n = 0; n < num_nodes; n++) {
-        if (interp) fdm_diagonal[c * num_nodes + n] = 1.0;
+        CeedScalar fdm_diagonal = interp ? 1.0 : 0.0;
+
         if (grad) {
           for (CeedInt d = 0; d < dim; d++) {
             CeedInt i = (n / CeedIntPow(P_1d, d)) % P_1d;
-            fdm_diagonal[c * num_nodes + n] += lambda[i];
+            fdm_diagonal += lambda[i];
           }
         }
-        if (fabs(fdm_diagonal[c * num_nodes + n]) < fdm_diagonal_bound) fdm_diagonal[c * num_nodes + n] = fdm_diagonal_bound;
+        if (fabs(fdm_diagonal) < fdm_diagonal_bound) fdm_diagonal = fdm_diagonal_bound;
+        fdm_diagonal_inv[c * num_nodes + n] = 1. / fdm_diagonal;
       }
     }
     CeedCall(CeedVectorCreate(ceed_parent, num_elem * num_comp * num_nodes, &q_data));
-    CeedCall(CeedVectorSetValue(q_data, 0.0));
     CeedCall(CeedVectorGetArrayWrite(q_data, CEED_MEM_HOST, &q_data_array));
+    // -- Variable coefficient scaling of each element
+    CeedPragmaOMP(parallel for num_threads(num_threads) schedule(static))
     for (CeedInt e = 0; e < num_elem; e++) {
-      for (CeedInt c = 0; c < num_comp; c++) {
-        for (CeedInt n = 0; n < num_nodes; n++) {
-          q_data_array[(e * num_comp + c) * num_nodes + n] = 1. / (elem_avg[e] * fdm_diagonal[c * num_nodes + n]);
-        }
-      }
+      const CeedScalar elem_avg_inv = 1. / elem_avg[e];
+      CeedScalar      *q_data_elem  = &q_data_array[(CeedSize)e * num_comp * num_nodes];
+
+      CeedPragmaSIMD for (CeedInt i = 0; i < num_comp * num_nodes; i++) q_data_elem[i] = elem_avg_inv * fdm_diagonal_inv[i];
     }
     CeedCall(CeedFree(&elem_avg));
-    CeedCall(CeedFree(&fdm_diagonal));
+    CeedCall(CeedFree(&fdm_diagonal_inv));
     CeedCall(CeedVectorRestoreArray(q_data, &q_data_array));
   }
 
   // Setup FDM operator
-  // -- Basis
-  {
-    CeedScalar *grad_dummy, *q_ref_dummy, *q_weight_dummy;
-
-    CeedCall(CeedCalloc(P_1d * P_1d, &grad_dummy));
-    CeedCall(CeedCalloc(P_1d, &q_ref_dummy));
-    CeedCall(CeedCalloc(P_1d, &q_weight_dummy));
-    CeedCall(CeedBasisCreateTensorH1(ceed_parent, dim, num_comp, P_1d, P_1d, fdm_interp, grad_dummy, q_ref_dummy, q_weight_dummy, &fdm_basis));
-    CeedCall(CeedFree(&fdm_interp));
-    CeedCall(CeedFree(&grad_dummy));
-    CeedCall(CeedFree(&q_ref_dummy));
-    CeedCall(CeedFree(&q_weight_dummy));
-    CeedCall(CeedFree(&lambda));
-  }
-
   // -- Restriction
   {
     CeedInt strides[3] = {1, num_nodes, num_nodes * num_comp};
@@ -2934,13 +3945,13 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedCall(CeedOperatorSetField(*fdm_inv, "input", rstr, fdm_basis, CEED_VECTOR_ACTIVE));
   CeedCall(CeedOperatorSetField(*fdm_inv, "scale", rstr_qd_i, CEED_BASIS_NONE, q_data));
   CeedCall(CeedOperatorSetField(*fdm_inv, "output", rstr, fdm_basis, CEED_VECTOR_ACTIVE));
+  (*fdm_inv)->is_fdm_inverse = true;
 
   // Cleanup
   CeedCall(CeedVectorDestroy(&q_data));
   CeedCall(CeedElemRestrictionDestroy(&rstr));
   CeedCall(CeedElemRestrictionDestroy(&rstr_qd_i));
   CeedCall(CeedBasisDestroy(&basis));
-  CeedCall(CeedBasisDestroy(&fdm_basis));
   CeedCall(CeedQFunctionDestroy(&qf_fdm));
   return CEED_ERROR_SUCCESS;
 }
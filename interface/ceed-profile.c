@@ -0,0 +1,829 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200112
+#define _DEFAULT_SOURCE
+#include <ceed-impl.h>
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+// Hardware counters need the Linux kernel UAPI headers for perf_event_open
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#define CEED_PROFILE_PERF_EVENT
+#endif
+#endif
+#ifdef CEED_PROFILE_PERF_EVENT
+#include <errno.h>
+#include <unistd.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+// Names of the hardware counters, in the order of CeedProfileStage.counters
+static const char *const counter_names[CEED_PROFILE_NUM_COUNTERS] = {"cycles", "instructions", "L1D misses", "LLC misses", "FP ops"};
+
+/// @file
+/// Implementation of Ceed profiling interfaces
+
+/// ----------------------------------------------------------------------------
+/// Ceed Library Internal Profiling Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedDeveloper
+/// @{
+
+/**
+  @brief Get the wall time in seconds from a monotonic clock
+
+  @return Wall time in seconds
+
+  @ref Developer
+**/
+static double CeedProfileGetTime(void) {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double)time.tv_sec + 1e-9 * (double)time.tv_nsec;
+}
+
+/**
+  @brief Open the hardware performance counters of the calling thread with `perf_event_open`.
+
+  Counters not supported by the kernel or hardware are skipped, and no counters are opened on systems without `perf_event_open`.
+  The FP ops counter is a raw event code read from the environment variable `CEED_PROFILE_FP_EVENT`, as there is no portable event for vector floating point operations.
+
+  @param[in,out] profile Profile to open counters for
+  @param[in]     inherit Boolean flag to also count threads started later by the calling thread
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileOpenCounters(CeedProfile profile, bool inherit) {
+  for (CeedInt i = 0; i < CEED_PROFILE_NUM_COUNTERS; i++) profile->counter_index[i] = -1;
+#ifdef CEED_PROFILE_PERF_EVENT
+  const char    *fp_event        = getenv("CEED_PROFILE_FP_EVENT");
+  const uint64_t l1d_read_misses = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+  const uint32_t types[CEED_PROFILE_NUM_COUNTERS]   = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_RAW};
+  const uint64_t configs[CEED_PROFILE_NUM_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, l1d_read_misses,
+                                                       PERF_COUNT_HW_CACHE_MISSES, fp_event ? strtoull(fp_event, NULL, 0) : 0};
+
+  for (CeedInt i = 0; i < CEED_PROFILE_NUM_COUNTERS; i++) {
+    struct perf_event_attr attr;
+    long                   fd;
+
+    if (types[i] == PERF_TYPE_RAW && !fp_event) continue;
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = types[i];
+    attr.config         = configs[i];
+    attr.disabled       = profile->num_counters == 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.inherit        = inherit;  // Also count threads started later, such as OpenMP threads of the CPU backends
+    attr.read_format    = PERF_FORMAT_GROUP;
+    fd                  = syscall(SYS_perf_event_open, &attr, 0, -1, profile->num_counters ? profile->counter_fds[0] : -1, 0);
+    // Older kernels do not read inherited counters as a group
+    if (fd < 0 && errno == EINVAL && attr.inherit) {
+      attr.inherit = 0;
+      fd           = syscall(SYS_perf_event_open, &attr, 0, -1, profile->num_counters ? profile->counter_fds[0] : -1, 0);
+    }
+    if (fd < 0) continue;
+    profile->counter_fds[profile->num_counters] = (int)fd;
+    profile->counter_index[i]                   = profile->num_counters++;
+  }
+  if (profile->num_counters > 0) ioctl(profile->counter_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Close the hardware performance counters of a profile
+
+  @param[in,out] profile Profile to close counters for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileCloseCounters(CeedProfile profile) {
+#ifdef CEED_PROFILE_PERF_EVENT
+  for (CeedInt i = profile->num_counters - 1; i >= 0; i--) close(profile->counter_fds[i]);
+#endif
+  profile->num_counters = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read the hardware performance counters of a profile, with zero for unavailable counters
+
+  @param[in]  profile  Profile to read counters for
+  @param[out] counters Array of size `CEED_PROFILE_NUM_COUNTERS` to store counter values
+
+  @ref Developer
+**/
+static void CeedProfileReadCounters(CeedProfile profile, uint64_t counters[CEED_PROFILE_NUM_COUNTERS]) {
+  memset(counters, 0, CEED_PROFILE_NUM_COUNTERS * sizeof(counters[0]));
+#ifdef CEED_PROFILE_PERF_EVENT
+  uint64_t values[1 + CEED_PROFILE_NUM_COUNTERS] = {0};
+
+  if (profile->num_counters == 0) return;
+  // Group read format is the number of counters followed by their values
+  if (read(profile->counter_fds[0], values, sizeof(values)) < (ssize_t)sizeof(values[0])) return;
+  for (CeedInt i = 0; i < CEED_PROFILE_NUM_COUNTERS; i++) {
+    if (profile->counter_index[i] >= 0 && (uint64_t)profile->counter_index[i] < values[0]) counters[i] = values[1 + profile->counter_index[i]];
+  }
+#endif
+}
+
+/**
+  @brief View the hardware counter totals of a profiled stage on one line
+
+  @param[in] profile Profile holding the stage
+  @param[in] stage   Stage to view
+  @param[in] pre     Prefix for the line
+  @param[in] stream  Stream to view to
+
+  @ref Developer
+**/
+static void CeedProfileStageCountersView(CeedProfile profile, const CeedProfileStage *stage, const char *pre, FILE *stream) {
+  fprintf(stream, "%s%s", pre, stage->event_name);
+  if (stage->object_name) fprintf(stream, " [%s]", stage->object_name);
+  for (CeedInt i = 0, num_viewed = 0; i < CEED_PROFILE_NUM_COUNTERS; i++) {
+    if (profile->counter_index[i] < 0) continue;
+    fprintf(stream, "%s %s %" PRIu64, num_viewed++ ? "," : ":", counter_names[i], stage->counters[i]);
+  }
+  if (profile->counter_index[0] >= 0 && profile->counter_index[1] >= 0 && stage->counters[0] > 0) {
+    fprintf(stream, ", IPC %.2f", (double)stage->counters[1] / stage->counters[0]);
+  }
+  fprintf(stream, "\n");
+}
+
+/**
+  @brief Enable profiling of a root `Ceed` with the environment variables `CEED_PROFILE`, `CEED_PROFILE_TRACE`, or `CEED_PROFILE_COUNTERS`
+
+  @param[in,out] root Top-most parent `Ceed`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileSetFromEnv(Ceed root) {
+  root->is_profile_env_applied = true;
+  if (getenv("CEED_PROFILE")) {
+    CeedCall(CeedSetProfiling(root, true));
+    root->profile->is_view_on_destroy = true;
+  }
+  if (getenv("CEED_PROFILE_TRACE")) {
+    CeedCall(CeedSetProfiling(root, true));
+    CeedCall(CeedSetProfilingTraceFile(root, getenv("CEED_PROFILE_TRACE")));
+  }
+  if (getenv("CEED_PROFILE_COUNTERS")) {
+    CeedCall(CeedSetProfiling(root, true));
+    CeedCall(CeedSetProfilingCounters(root, true));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the top-most `Ceed` that holds the profile for a `Ceed`, following delegate and fallback parents
+
+  The profiling environment variables are applied to the top-most `Ceed` on first use, rather than in @ref CeedInit(), so delegate and fallback `Ceed`, which record to their parent, never create a profile of their own.
+
+  @param[in]  ceed `Ceed` context
+  @param[out] root Top-most parent `Ceed`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileGetRoot(Ceed ceed, Ceed *root) {
+  *root = ceed;
+  while ((*root)->parent || (*root)->op_fallback_parent) *root = (*root)->parent ? (*root)->parent : (*root)->op_fallback_parent;
+  if (!(*root)->is_profile_env_applied) CeedCall(CeedProfileSetFromEnv(*root));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the profile for a `Ceed`, creating it if needed
+
+  @param[in]  ceed    `Ceed` context
+  @param[out] profile Profile held by the top-most parent `Ceed`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileGet(Ceed ceed, CeedProfile *profile) {
+  Ceed root;
+
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  if (!root->profile) {
+    CeedCall(CeedCalloc(1, &root->profile));
+    root->profile->start_time = CeedProfileGetTime();
+  }
+  *profile = root->profile;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a string to a JSON file, escaping quotes and backslashes
+
+  @param[in] file   File to write to
+  @param[in] string String to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileWriteJSONString(FILE *file, const char *string) {
+  fputc('"', file);
+  for (const char *c = string; *c; c++) {
+    if (*c == '"' || *c == '\\') fputc('\\', file);
+    if ((unsigned char)*c >= 0x20) fputc(*c, file);
+  }
+  fputc('"', file);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write recorded events of a `Ceed` profile in Chrome trace event format
+
+  The file can be loaded in `chrome://tracing` or Perfetto.
+
+  @param[in] ceed    `Ceed` context for error handling
+  @param[in] profile Profile to write
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileWriteTrace(Ceed ceed, CeedProfile profile) {
+  FILE *file = fopen(profile->trace_file_name, "w");
+
+  CeedCheck(file, ceed, CEED_ERROR_MAJOR, "Could not open profiling trace file %s", profile->trace_file_name);
+  fprintf(file, "{\"traceEvents\": [\n");
+  for (CeedInt i = 0; i < profile->num_trace_events; i++) {
+    const CeedProfileTraceEvent *event = &profile->trace_events[i];
+    const CeedProfileStage      *stage = &profile->stages[event->stage];
+
+    fprintf(file, "  {\"name\": ");
+    CeedProfileWriteJSONString(file, stage->object_name ? stage->object_name : stage->event_name);
+    fprintf(file, ", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %" CeedInt_FMT ", \"ts\": %.3f, \"dur\": %.3f}%s\n", stage->event_name,
+            event->thread, 1e6 * (event->start_time - profile->start_time), 1e6 * event->duration, i < profile->num_trace_events - 1 ? "," : "");
+  }
+  fprintf(file, "], \"displayTimeUnit\": \"ms\"}\n");
+  fclose(file);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compare profile stages by decreasing time, for use with `qsort`
+
+  @param[in] a First stage
+  @param[in] b Second stage
+
+  @return Negative if `a` took longer than `b`, positive if shorter, otherwise zero
+
+  @ref Developer
+**/
+static int CeedProfileStageCompare(const void *a, const void *b) {
+  const double time_a = (*(const CeedProfileStage **)a)->time, time_b = (*(const CeedProfileStage **)b)->time;
+
+  return (time_a < time_b) - (time_a > time_b);
+}
+
+/**
+  @brief Find the stage of a profile for an event and object name, adding it if needed
+
+  @param[in,out] profile     Profile holding the stages
+  @param[in]     event_name  Name of the interface function
+  @param[in]     object_name Name of the object, or `NULL`
+  @param[out]    stage_index Index of the stage
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileGetStage(CeedProfile profile, const char *event_name, const char *object_name, CeedInt *stage_index) {
+  CeedInt i;
+
+  for (i = 0; i < profile->num_stages; i++) {
+    const CeedProfileStage *stage = &profile->stages[i];
+
+    if (strcmp(stage->event_name, event_name)) continue;
+    if ((!stage->object_name && !object_name) || (stage->object_name && object_name && !strcmp(stage->object_name, object_name))) break;
+  }
+  if (i == profile->num_stages) {
+    if (profile->num_stages == profile->max_stages) {
+      profile->max_stages = profile->max_stages ? 2 * profile->max_stages : 16;
+      CeedCall(CeedRealloc(profile->max_stages, &profile->stages));
+    }
+    memset(&profile->stages[i], 0, sizeof(profile->stages[i]));
+    profile->stages[i].event_name = event_name;
+    if (object_name) CeedCall(CeedStringAllocCopy(object_name, &profile->stages[i].object_name));
+    profile->num_stages++;
+  }
+  *stage_index = i;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Start recording an event in a profile, see @ref CeedProfileEventBegin()
+
+  @param[in,out] profile     Profile to record to
+  @param[in]     event_name  Name of the interface function
+  @param[in]     object_name Name of the object, or `NULL` to use the name of the enclosing event
+  @param[in]     num_scalars Number of input and output scalars accessed by the call
+  @param[out]    event       Handle to pass to @ref CeedProfileEnd()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileBegin(CeedProfile profile, const char *event_name, const char *object_name, CeedSize num_scalars, CeedInt *event) {
+  CeedInt          stage_index;
+  CeedProfileFrame frame;
+
+  // Inherit name of enclosing event
+  if (!object_name && profile->num_frames > 0) object_name = profile->frames[profile->num_frames - 1].object_name;
+
+  // Find or add stage
+  CeedCall(CeedProfileGetStage(profile, event_name, object_name, &stage_index));
+  profile->stages[stage_index].count++;
+  profile->stages[stage_index].bytes += num_scalars * (CeedSize)sizeof(CeedScalar);
+
+  // Push frame
+  if (profile->num_frames == profile->max_frames) {
+    profile->max_frames = profile->max_frames ? 2 * profile->max_frames : 8;
+    CeedCall(CeedRealloc(profile->max_frames, &profile->frames));
+  }
+  CeedProfileReadCounters(profile, frame.start_counters);
+  frame.stage                            = stage_index;
+  frame.object_name                      = profile->stages[stage_index].object_name;
+  frame.start_time                       = CeedProfileGetTime();
+  *event                                 = profile->num_frames;
+  profile->frames[profile->num_frames++] = frame;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Finish recording an event in a profile, see @ref CeedProfileEventEnd()
+
+  @param[in,out] profile    Profile to record to
+  @param[in]     event      Handle from @ref CeedProfileBegin()
+  @param[in]     thread     Thread number to record in the trace
+  @param[in]     is_tracing Boolean flag to record the event for the trace file
+  @param[out]    duration   Variable to store the wall time of the event in seconds, or `NULL`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileEnd(CeedProfile profile, CeedInt event, CeedInt thread, bool is_tracing, double *duration) {
+  double           elapsed;
+  CeedProfileFrame frame;
+
+  if (event >= profile->num_frames) return CEED_ERROR_SUCCESS;
+  frame   = profile->frames[event];
+  elapsed = CeedProfileGetTime() - frame.start_time;
+  if (profile->num_counters > 0) {
+    uint64_t counters[CEED_PROFILE_NUM_COUNTERS];
+
+    CeedProfileReadCounters(profile, counters);
+    for (CeedInt i = 0; i < CEED_PROFILE_NUM_COUNTERS; i++) profile->stages[frame.stage].counters[i] += counters[i] - frame.start_counters[i];
+  }
+
+  // Pop frame, and any frames left open by errors in nested events
+  profile->num_frames = event;
+  profile->stages[frame.stage].time += elapsed;
+  if (duration) *duration = elapsed;
+
+  // Record trace event
+  if (is_tracing) {
+    if (profile->num_trace_events == profile->max_trace_events) {
+      profile->max_trace_events = profile->max_trace_events ? 2 * profile->max_trace_events : 256;
+      CeedCall(CeedRealloc(profile->max_trace_events, &profile->trace_events));
+    }
+    profile->trace_events[profile->num_trace_events].stage      = frame.stage;
+    profile->trace_events[profile->num_trace_events].thread     = thread;
+    profile->trace_events[profile->num_trace_events].start_time = frame.start_time;
+    profile->trace_events[profile->num_trace_events].duration   = elapsed;
+    profile->num_trace_events++;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Free the stages, frames, trace events, and hardware counters of a profile
+
+  @param[in,out] profile Profile to free data for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileFreeData(CeedProfile profile) {
+  CeedCall(CeedProfileCloseCounters(profile));
+  for (CeedInt i = 0; i < profile->num_stages; i++) CeedCall(CeedFree(&profile->stages[i].object_name));
+  CeedCall(CeedFree(&profile->stages));
+  CeedCall(CeedFree(&profile->frames));
+  CeedCall(CeedFree(&profile->trace_events));
+  CeedCall(CeedFree(&profile->trace_file_name));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Start recording a profiling event for an interface function call.
+
+  Events nest, and an event without an object name is recorded under the name of the enclosing event, so the restriction, basis, and `CeedQFunction` stages of a `CeedOperator` are grouped by the name set with @ref CeedOperatorSetName().
+  Events inside OpenMP parallel regions are only recorded between @ref CeedProfileThreadsBegin() and @ref CeedProfileThreadsEnd(), separately for each thread.
+
+  @param[in]  ceed        `Ceed` context of the object
+  @param[in]  event_name  Name of the interface function
+  @param[in]  object_name Name of the object, or `NULL` to use the name of the enclosing event
+  @param[in]  num_scalars Number of input and output scalars accessed by the call
+  @param[out] event       Handle to pass to @ref CeedProfileEventEnd(), negative if the event is not recorded
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedProfileEventBegin(Ceed ceed, const char *event_name, const char *object_name, CeedSize num_scalars, CeedInt *event) {
+  Ceed        root;
+  CeedProfile profile;
+
+  *event = -1;
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  profile = root->profile;
+  if (!profile || !profile->is_profiling) return CEED_ERROR_SUCCESS;
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const int   thread = omp_get_thread_num();
+    CeedProfile profile_thread;
+
+    if (thread >= profile->num_threads) return CEED_ERROR_SUCCESS;
+    profile_thread = profile->threads[thread];
+    // Outermost events of a thread nest under the events open when the threaded region started
+    if (!object_name && profile_thread->num_frames == 0 && profile->num_frames > 0) {
+      object_name = profile->frames[profile->num_frames - 1].object_name;
+    }
+    // Counters of the thread are opened by the thread itself, for the duration of the threaded region
+    if (profile->use_counters && !profile_thread->use_counters) {
+      CeedCall(CeedProfileOpenCounters(profile_thread, false));
+      profile_thread->use_counters = true;
+    }
+    return CeedProfileBegin(profile_thread, event_name, object_name, num_scalars, event);
+  }
+#endif
+  return CeedProfileBegin(profile, event_name, object_name, num_scalars, event);
+}
+
+/**
+  @brief Finish recording a profiling event started with @ref CeedProfileEventBegin().
+
+  @param[in]  ceed     `Ceed` context of the object
+  @param[in]  event    Handle from @ref CeedProfileEventBegin()
+  @param[out] duration Variable to store the wall time of the event in seconds, or `NULL`; unchanged if the event is not recorded
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedProfileEventEnd(Ceed ceed, CeedInt event, double *duration) {
+  Ceed        root;
+  CeedProfile profile;
+
+  if (event < 0) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  profile = root->profile;
+  if (!profile) return CEED_ERROR_SUCCESS;
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const int thread = omp_get_thread_num();
+
+    if (thread >= profile->num_threads) return CEED_ERROR_SUCCESS;
+    return CeedProfileEnd(profile->threads[thread], event, thread, profile->trace_file_name != NULL, duration);
+  }
+#endif
+  return CeedProfileEnd(profile, event, 0, profile->trace_file_name != NULL, duration);
+}
+
+/**
+  @brief Start recording profiling events separately for each thread of an OpenMP parallel region.
+
+  Call before the parallel region starts, and call @ref CeedProfileThreadsEnd() after it ends to merge the events of all threads.
+  The wall times and hardware counters of the stages recorded inside the region are summed over the threads.
+
+  @param[in] ceed        `Ceed` context
+  @param[in] num_threads Number of threads of the parallel region
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedProfileThreadsBegin(Ceed ceed, CeedInt num_threads) {
+  Ceed        root;
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  profile = root->profile;
+  if (!profile || !profile->is_profiling) return CEED_ERROR_SUCCESS;
+  if (num_threads > profile->max_threads) {
+    CeedCall(CeedRealloc(num_threads, &profile->threads));
+    for (CeedInt t = profile->max_threads; t < num_threads; t++) CeedCall(CeedCalloc(1, &profile->threads[t]));
+    profile->max_threads = num_threads;
+  }
+  profile->num_threads = num_threads;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Merge the profiling events recorded by each thread since @ref CeedProfileThreadsBegin().
+
+  @param[in] ceed `Ceed` context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedProfileThreadsEnd(Ceed ceed) {
+  Ceed        root;
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  profile = root->profile;
+  if (!profile || profile->num_threads == 0) return CEED_ERROR_SUCCESS;
+  for (CeedInt t = 0; t < profile->num_threads; t++) {
+    CeedProfile profile_thread = profile->threads[t];
+    CeedInt    *stage_indices;
+
+    // Add stage totals
+    CeedCall(CeedCalloc(profile_thread->num_stages, &stage_indices));
+    for (CeedInt i = 0; i < profile_thread->num_stages; i++) {
+      CeedProfileStage *stage_thread = &profile_thread->stages[i], *stage;
+
+      CeedCall(CeedProfileGetStage(profile, stage_thread->event_name, stage_thread->object_name, &stage_indices[i]));
+      stage = &profile->stages[stage_indices[i]];
+      stage->count += stage_thread->count;
+      stage->time += stage_thread->time;
+      stage->bytes += stage_thread->bytes;
+      for (CeedInt j = 0; j < CEED_PROFILE_NUM_COUNTERS; j++) stage->counters[j] += stage_thread->counters[j];
+      CeedCall(CeedFree(&stage_thread->object_name));
+    }
+
+    // Add trace events
+    if (profile->trace_file_name && profile_thread->num_trace_events > 0) {
+      const CeedInt num_trace_events = profile->num_trace_events + profile_thread->num_trace_events;
+
+      if (num_trace_events > profile->max_trace_events) {
+        profile->max_trace_events = CeedIntMax(num_trace_events, 2 * profile->max_trace_events);
+        CeedCall(CeedRealloc(profile->max_trace_events, &profile->trace_events));
+      }
+      for (CeedInt i = 0; i < profile_thread->num_trace_events; i++) {
+        CeedProfileTraceEvent *event = &profile->trace_events[profile->num_trace_events++];
+
+        *event       = profile_thread->trace_events[i];
+        event->stage = stage_indices[event->stage];
+      }
+    }
+    CeedCall(CeedFree(&stage_indices));
+
+    // Reset thread profile for the next threaded region
+    profile_thread->num_stages       = 0;
+    profile_thread->num_frames       = 0;
+    profile_thread->num_trace_events = 0;
+    if (profile_thread->use_counters) {
+      CeedCall(CeedProfileCloseCounters(profile_thread));
+      profile_thread->use_counters = false;
+    }
+  }
+  profile->num_threads = 0;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View the hardware counter totals of the profiled stages of a named object, such as a `CeedOperator`.
+
+  Nothing is written unless hardware counters are recorded.
+
+  @param[in] ceed        `Ceed` context of the object
+  @param[in] object_name Name of the object
+  @param[in] pre         Prefix for each line
+  @param[in] stream      Stream to view to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileCountersView(Ceed ceed, const char *object_name, const char *pre, FILE *stream) {
+  Ceed        root;
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  profile = root->profile;
+  if (!profile || profile->num_counters == 0 || !object_name) return CEED_ERROR_SUCCESS;
+  fprintf(stream, "%sHardware counters of the calling thread, totals over all calls:\n", pre);
+  for (CeedInt i = 0; i < profile->num_stages; i++) {
+    const CeedProfileStage *stage = &profile->stages[i];
+    char                    stage_pre[32];
+
+    if (!stage->object_name || strcmp(stage->object_name, object_name)) continue;
+    snprintf(stage_pre, sizeof(stage_pre), "%s  ", pre);
+    CeedProfileStageCountersView(profile, stage, stage_pre, stream);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write and destroy the profile of a `Ceed`.
+
+  The summary is written to `stdout` if profiling was enabled with the `CEED_PROFILE` environment variable, and the Chrome trace is written if a trace file was set.
+
+  @param[in,out] ceed `Ceed` context to destroy profile for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileDestroy(Ceed ceed) {
+  const bool  is_root = !ceed->parent && !ceed->op_fallback_parent;
+  CeedProfile profile;
+
+  // Apply profiling environment variables, in case no call was profiled, so the summary is still written
+  if (is_root && !ceed->is_profile_env_applied) CeedCall(CeedProfileSetFromEnv(ceed));
+  profile = ceed->profile;
+  if (!profile) return CEED_ERROR_SUCCESS;
+  // Delegate and fallback Ceeds record to their parent
+  if (is_root) {
+    if (profile->is_view_on_destroy) CeedCall(CeedProfilingView(ceed, stdout));
+    if (profile->trace_file_name) CeedCall(CeedProfileWriteTrace(ceed, profile));
+  }
+  for (CeedInt t = 0; t < profile->max_threads; t++) {
+    CeedCall(CeedProfileFreeData(profile->threads[t]));
+    CeedCall(CeedFree(&profile->threads[t]));
+  }
+  CeedCall(CeedFree(&profile->threads));
+  CeedCall(CeedProfileFreeData(profile));
+  CeedCall(CeedFree(&ceed->profile));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// Ceed Public Profiling API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedUser
+/// @{
+
+/**
+  @brief Enable or disable recording of wall time, call counts, and bytes accessed for `CeedOperatorApply()`, `CeedElemRestrictionApply()`, `CeedBasisApply()`, and `CeedQFunctionApply()` calls.
+
+  Profiling can also be enabled by setting the environment variable `CEED_PROFILE`, in which case a summary is written to `stdout` by @ref CeedDestroy().
+
+  @param[in,out] ceed         `Ceed` context
+  @param[in]     is_profiling Boolean flag to enable profiling
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetProfiling(Ceed ceed, bool is_profiling) {
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGet(ceed, &profile));
+  profile->is_profiling = is_profiling;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get flag indicating if profiling is enabled for a `Ceed` context
+
+  @param[in]  ceed         `Ceed` context
+  @param[out] is_profiling Variable to store profiling status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedIsProfiling(Ceed ceed, bool *is_profiling) {
+  Ceed root;
+
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  *is_profiling = root->profile && root->profile->is_profiling;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set a file to write recorded profiling events to in Chrome trace event format when the `Ceed` context is destroyed.
+
+  The file can also be set with the environment variable `CEED_PROFILE_TRACE`, which also enables profiling.
+  Each call is stored, so memory use grows with the number of profiled calls.
+
+  @param[in,out] ceed      `Ceed` context
+  @param[in]     file_name Path of the trace file, or `NULL` to stop recording events
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetProfilingTraceFile(Ceed ceed, const char *file_name) {
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGet(ceed, &profile));
+  CeedCall(CeedFree(&profile->trace_file_name));
+  if (file_name) CeedCall(CeedStringAllocCopy(file_name, &profile->trace_file_name));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Enable or disable recording of hardware performance counters for profiled calls.
+
+  The cycles, instructions, L1 data cache read misses, last level cache misses, and, if the environment variable `CEED_PROFILE_FP_EVENT` is set to a raw event code, floating point operations of the calling thread, and of threads it starts afterwards, are read with the Linux `perf_event_open` system call before and after each profiled call.
+  The threaded element loops of the `/cpu/self/ref/blocked`, `/cpu/self/opt/serial`, and `/cpu/self/opt/blocked` operators read separate counters for each OpenMP thread, and the counters of the stages inside these loops are summed over the threads; other calls made inside OpenMP parallel regions are not recorded.
+  Counters that are not available, for example without `perf_event_open` or on virtual machines without access to the performance monitoring unit, are skipped; if none are available, profiling continues without counters.
+  The totals are reported by @ref CeedProfilingView() and, for named `CeedOperator`, by @ref CeedOperatorView().
+  Counters can also be enabled by setting the environment variable `CEED_PROFILE_COUNTERS`, which also enables profiling.
+
+  @param[in,out] ceed         `Ceed` context
+  @param[in]     use_counters Boolean flag to enable hardware counters
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetProfilingCounters(Ceed ceed, bool use_counters) {
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGet(ceed, &profile));
+  if (use_counters == profile->use_counters) return CEED_ERROR_SUCCESS;
+  CeedCheck(profile->num_frames == 0, ceed, CEED_ERROR_ACCESS, "Cannot change hardware counters during a profiled call");
+  if (use_counters) CeedCall(CeedProfileOpenCounters(profile, true));
+  else CeedCall(CeedProfileCloseCounters(profile));
+  profile->use_counters = use_counters;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View a summary of profiled calls for a `Ceed` context, sorted by decreasing time.
+
+  Times are inclusive, so the time of a `CeedOperator` includes the time of its restriction, basis, and `CeedQFunction` stages.
+  Stages inside threaded element loops sum the time of all threads, so they may take longer than the enclosing `CeedOperator`.
+
+  @param[in] ceed   `Ceed` context
+  @param[in] stream Stream to view to, e.g., `stdout`
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedProfilingView(Ceed ceed, FILE *stream) {
+  Ceed               root;
+  CeedProfile        profile;
+  CeedProfileStage **sorted;
+
+  CeedCall(CeedProfileGetRoot(ceed, &root));
+  profile = root->profile;
+  fprintf(stream, "Ceed profile: %s\n", root->resource);
+  if (!profile || profile->num_stages == 0) {
+    fprintf(stream, "  No profiled calls\n");
+    return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedCalloc(profile->num_stages, &sorted));
+  for (CeedInt i = 0; i < profile->num_stages; i++) sorted[i] = &profile->stages[i];
+  qsort(sorted, profile->num_stages, sizeof(sorted[0]), CeedProfileStageCompare);
+  fprintf(stream, "  %-41s %-24s %10s %12s %14s %14s\n", "Event", "Object", "Count", "Time (s)", "Time/call (s)", "Bytes");
+  for (CeedInt i = 0; i < profile->num_stages; i++) {
+    const CeedProfileStage *stage = sorted[i];
+
+    fprintf(stream, "  %-41s %-24s %10" CeedInt_FMT " %12.4e %14.4e %14" CeedSize_FMT "\n", stage->event_name,
+            stage->object_name ? stage->object_name : "-", stage->count, stage->time, stage->time / stage->count, stage->bytes);
+  }
+  if (profile->use_counters) {
+    if (profile->num_counters == 0) {
+      fprintf(stream, "  Hardware counters unavailable\n");
+    } else {
+      fprintf(stream, "  Hardware counters of the calling thread:\n");
+      for (CeedInt i = 0; i < profile->num_stages; i++) CeedProfileStageCountersView(profile, sorted[i], "    ", stream);
+    }
+  }
+  CeedCall(CeedFree(&sorted));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
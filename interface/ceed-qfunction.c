@@ -1037,8 +1037,10 @@ Ceed CeedQFunctionReturnCeed(CeedQFunction qf) { return qf->ceed; }
   @ref User
 **/
 int CeedQFunctionApply(CeedQFunction qf, CeedInt Q, CeedVector *u, CeedVector *v) {
-  CeedInt vec_length;
-  Ceed    ceed;
+  bool     is_profiling;
+  CeedInt  vec_length, event;
+  CeedSize num_scalars = 0;
+  Ceed     ceed;
 
   CeedCall(CeedQFunctionGetCeed(qf, &ceed));
   CeedCheck(qf->Apply, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support CeedQFunctionApply");
@@ -1046,7 +1048,14 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q, CeedVector *u, CeedVector *v
   CeedCheck(Q % vec_length == 0, ceed, CEED_ERROR_DIMENSION, "Number of quadrature points %" CeedInt_FMT " must be a multiple of %" CeedInt_FMT, Q,
             qf->vec_length);
   CeedCall(CeedQFunctionSetImmutable(qf));
+  CeedCall(CeedIsProfiling(ceed, &is_profiling));
+  if (is_profiling) {
+    for (CeedInt i = 0; i < qf->num_input_fields; i++) num_scalars += (CeedSize)Q * qf->input_fields[i]->size;
+    for (CeedInt i = 0; i < qf->num_output_fields; i++) num_scalars += (CeedSize)Q * qf->output_fields[i]->size;
+  }
+  CeedCall(CeedProfileEventBegin(ceed, "CeedQFunctionApply", NULL, num_scalars, &event));
   CeedCall(qf->Apply(qf, Q, u, v));
+  CeedCall(CeedProfileEventEnd(ceed, event, NULL));
   return CEED_ERROR_SUCCESS;
 }
 
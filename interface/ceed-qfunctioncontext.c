@@ -532,6 +532,21 @@ int CeedQFunctionContextGetDataDestroy(CeedQFunctionContext ctx, CeedMemType *f_
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get reduction routine for private thread copies of `CeedQFunctionContext` user data
+
+  @param[in]  ctx `CeedQFunctionContext` to get user reduction function
+  @param[out] f   Routine to use to combine private thread copies of user data, or `NULL` if not set
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedQFunctionContextGetDataReduce(CeedQFunctionContext ctx, CeedQFunctionContextDataReduceUser *f) {
+  *f = ctx->data_reduce_function;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Increment the reference counter for a `CeedQFunctionContext`
 
@@ -920,6 +935,27 @@ int CeedQFunctionContextSetDataDestroy(CeedQFunctionContext ctx, CeedMemType f_m
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set reduction routine for private thread copies of writable `CeedQFunctionContext` user data.
+
+  Backends that split a `CeedQFunction` application across threads give each thread a private copy of writable context data, initialized from the context data.
+  After the application, `f` is called on the host once per thread copy, in thread order, to combine it into the context data.
+  The context data before the application is also passed to `f`, e.g. so that sums accumulated in the context can add only the contribution of each thread.
+  Without this routine, `CeedQFunction` with writable contexts are not split across threads.
+
+  @param[in,out] ctx `CeedQFunctionContext` to set user reduction function
+  @param[in]     f   Routine to use to combine private thread copies of user data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedQFunctionContextSetDataReduce(CeedQFunctionContext ctx, CeedQFunctionContextDataReduceUser f) {
+  CeedCheck(f, CeedQFunctionContextReturnCeed(ctx), 1, "Must provide valid callback function for reducing user data");
+  ctx->data_reduce_function = f;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Destroy a `CeedQFunctionContext`
 
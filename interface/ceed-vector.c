@@ -659,15 +659,19 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   *norm = 0.;
   switch (norm_type) {
     case CEED_NORM_1:
+    case CEED_NORM_2: {
+      // Kahan compensated summation
+      CeedScalar compensation = 0.;
+
       for (CeedSize i = 0; i < length; i++) {
-        *norm += fabs(array[i]);
-      }
-      break;
-    case CEED_NORM_2:
-      for (CeedSize i = 0; i < length; i++) {
-        *norm += fabs(array[i]) * fabs(array[i]);
+        const CeedScalar value = (norm_type == CEED_NORM_1 ? fabs(array[i]) : array[i] * array[i]) - compensation;
+        const CeedScalar sum   = *norm + value;
+
+        compensation = (sum - *norm) - value;
+        *norm        = sum;
       }
       break;
+    }
     case CEED_NORM_MAX:
       for (CeedSize i = 0; i < length; i++) {
         const CeedScalar abs_v_i = fabs(array[i]);
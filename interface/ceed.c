@@ -175,6 +175,27 @@ static int CeedWorkVectorsDestroy(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Destroy the cache of `CeedBasis` projection matrices for a `ceed`
+
+  @param[in,out] ceed `Ceed` to destroy projection cache for
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedBasisProjectionsDestroy(Ceed ceed) {
+  if (!ceed->basis_projections) return CEED_ERROR_SUCCESS;
+  for (CeedInt i = 0; i < ceed->basis_projections->num_projections; i++) {
+    CeedCall(CeedFree(&ceed->basis_projections->projections[i].key));
+    CeedCall(CeedFree(&ceed->basis_projections->projections[i].interp_project));
+    CeedCall(CeedFree(&ceed->basis_projections->projections[i].grad_project));
+  }
+  CeedCall(CeedFree(&ceed->basis_projections->projections));
+  CeedCall(CeedFree(&ceed->basis_projections));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -792,6 +813,7 @@ int CeedReference(Ceed ceed) {
   @brief Get a `CeedVector` for scratch work from a `Ceed` context.
 
   Note: This vector must be restored with @ref CeedRestoreWorkVector().
+        If the `Ceed` delegates `CeedVector` creation, the work vector is held by the delegate.
 
   @param[in]  ceed `Ceed` context
   @param[in]  len  Minimum length of work vector
@@ -804,6 +826,15 @@ int CeedReference(Ceed ceed) {
 int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
   CeedInt i = 0;
 
+  // Work vectors are held by the Ceed that creates the vectors
+  if (!ceed->VectorCreate) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "Vector"));
+    CeedCheck(delegate, ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement VectorCreate");
+    CeedCall(CeedGetWorkVector(delegate, len, vec));
+    return CEED_ERROR_SUCCESS;
+  }
   if (!ceed->work_vectors) CeedCall(CeedWorkVectorsCreate(ceed));
 
   // Search for big enough work vector
@@ -849,6 +880,13 @@ int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
   @ref Backend
 **/
 int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
+  if (!ceed->VectorCreate) {
+    Ceed delegate;
+
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "Vector"));
+    CeedCall(CeedRestoreWorkVector(delegate, vec));
+    return CEED_ERROR_SUCCESS;
+  }
   for (CeedInt i = 0; i < ceed->work_vectors->num_vecs; i++) {
     if (*vec == ceed->work_vectors->vecs[i]) {
       CeedCheck(ceed->work_vectors->is_in_use[i], ceed, CEED_ERROR_ACCESS, "Work vector %" CeedSize_FMT " was not checked out but is being returned");
@@ -1100,6 +1138,8 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddElementMatrices),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddFDMElementInverse),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
       CEED_FTABLE_ENTRY(CeedOperator, Destroy),
       {NULL, 0}  // End of lookup table - used in SetBackendFunction loop
@@ -1300,6 +1340,7 @@ int CeedDestroy(Ceed *ceed) {
     }
     CeedCall(CeedFree(&(*ceed)->obj_delegates));
   }
+  CeedCall(CeedProfileDestroy(*ceed));
 
   if ((*ceed)->Destroy) CeedCall((*ceed)->Destroy(*ceed));
 
@@ -1313,6 +1354,7 @@ int CeedDestroy(Ceed *ceed) {
   CeedCall(CeedDestroy(&(*ceed)->op_fallback_ceed));
   CeedCall(CeedFree(&(*ceed)->op_fallback_resource));
   CeedCall(CeedWorkVectorsDestroy(*ceed));
+  CeedCall(CeedBasisProjectionsDestroy(*ceed));
   CeedCall(CeedFree(ceed));
   return CEED_ERROR_SUCCESS;
 }
@@ -0,0 +1,70 @@
+/// @file
+/// Test arithmetic and norms of long vectors
+/// \test Test arithmetic and norms of long vectors
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, y;
+  CeedInt    len = 1000003;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, len, &x);
+  CeedVectorCreate(ceed, len, &y);
+  CeedVectorSetValue(x, 0.1);
+  {
+    CeedScalar *array;
+
+    CeedVectorGetArrayWrite(y, CEED_MEM_HOST, &array);
+    for (CeedInt i = 0; i < len; i++) array[i] = i % 17;
+    CeedVectorRestoreArray(y, &array);
+  }
+
+  // Norms, with rounding error independent of the vector length
+  {
+    CeedScalar norm;
+
+    CeedVectorNorm(x, CEED_NORM_1, &norm);
+    if (fabs(norm / (len * 0.1) - 1.) > 100. * CEED_EPSILON) printf("Error: L1 norm %.16e != %.16e\n", norm, len * 0.1);
+    CeedVectorNorm(x, CEED_NORM_2, &norm);
+    if (fabs(norm / sqrt(len * (0.1 * 0.1)) - 1.) > 100. * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("Error: L2 norm %.16e != %.16e\n", norm, sqrt(len * (0.1 * 0.1)));
+      // LCOV_EXCL_STOP
+    }
+    CeedVectorNorm(y, CEED_NORM_MAX, &norm);
+    if (norm != 16.) printf("Error: Max norm %f != 16.\n", norm);
+  }
+
+  // Arithmetic
+  CeedVectorScale(x, 10.);
+  CeedVectorAXPBY(y, 2., 3., x);
+  CeedVectorAXPY(y, -1., x);
+  CeedVectorPointwiseMult(y, y, x);
+  CeedVectorPointwiseMult(y, y, y);
+  {
+    const CeedScalar *array;
+
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &array);
+    for (CeedInt i = 0; i < len; i++) {
+      const CeedScalar value = 3. * (i % 17) + 1.;
+
+      if (fabs(array[i] - value * value) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("Error: y[%" CeedInt_FMT "] %f != %f\n", i, array[i], value * value);
+        break;
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,60 @@
+/// @file
+/// Test coloring and view of an element restriction and a blocked element restriction
+/// \test Test coloring and view of an element restriction and a blocked element restriction
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedInt             num_elem = 10, elem_size = 2;
+  CeedInt             ind[elem_size * num_elem];
+  CeedElemRestriction elem_restriction, elem_restriction_blocked;
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind[2 * i + 0] = i;
+    ind[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_USE_POINTER, ind, &elem_restriction);
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, 3, 1, 1, num_elem + 1, CEED_MEM_HOST, CEED_USE_POINTER, ind, &elem_restriction_blocked);
+
+  // Blocks of the same color must not share nodes
+  for (CeedInt r = 0; r < 2; r++) {
+    CeedInt             block_size, num_colors;
+    const CeedInt      *color_offsets, *color_blocks;
+    CeedElemRestriction rstr = r == 0 ? elem_restriction : elem_restriction_blocked;
+
+    CeedElemRestrictionGetBlockSize(rstr, &block_size);
+    CeedElemRestrictionGetColoring(rstr, &num_colors, &color_offsets, &color_blocks);
+    for (CeedInt c = 0; c < num_colors; c++) {
+      CeedInt node_colors[num_elem + 1];
+
+      for (CeedInt i = 0; i < num_elem + 1; i++) node_colors[i] = -1;
+      for (CeedInt k = color_offsets[c]; k < color_offsets[c + 1]; k++) {
+        for (CeedInt e = color_blocks[k] * block_size; e < (color_blocks[k] + 1) * block_size && e < num_elem; e++) {
+          for (CeedInt i = 0; i < elem_size; i++) {
+            const CeedInt node = ind[e * elem_size + i];
+
+            if (node_colors[node] != -1 && node_colors[node] != color_blocks[k]) {
+              // LCOV_EXCL_START
+              printf("Blocks %" CeedInt_FMT " and %" CeedInt_FMT " of color %" CeedInt_FMT " share node %" CeedInt_FMT "\n", node_colors[node],
+                     color_blocks[k], c, node);
+              // LCOV_EXCL_STOP
+            }
+            node_colors[node] = color_blocks[k];
+          }
+        }
+      }
+    }
+  }
+
+  CeedElemRestrictionView(elem_restriction, stdout);
+  CeedElemRestrictionView(elem_restriction_blocked, stdout);
+
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedElemRestrictionDestroy(&elem_restriction_blocked);
+  CeedDestroy(&ceed);
+  return 0;
+}
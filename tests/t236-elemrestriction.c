@@ -0,0 +1,101 @@
+/// @file
+/// Test transpose of blocked standard, oriented, and curl-conforming oriented element restrictions applied to all elements
+/// \test Test transpose of blocked standard, oriented, and curl-conforming oriented element restrictions applied to all elements
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+// Check that restricting and then transposing the restriction scales each node by its multiplicity
+static void CheckTransposeRestrict(CeedElemRestriction elem_restriction, const char *name, CeedInt num_nodes, CeedInt num_comp,
+                                   const CeedScalar *multiplicity, CeedVector x, CeedVector y, CeedVector z) {
+  CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  CeedVectorSetValue(z, 0.0);
+  CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, z, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *x_array, *z_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    CeedVectorGetArrayRead(z, CEED_MEM_HOST, &z_array);
+    for (CeedInt c = 0; c < num_comp; c++) {
+      for (CeedInt i = 0; i < num_nodes; i++) {
+        const CeedInt index = i + c * num_nodes;
+
+        if (fabs(z_array[index] - multiplicity[i] * x_array[index]) > 10 * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("%s: Error in transpose restricted array z[%" CeedInt_FMT "] = %f != %f\n", name, index, (CeedScalar)z_array[index],
+                 multiplicity[i] * x_array[index]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+    CeedVectorRestoreArrayRead(z, &z_array);
+  }
+}
+
+int main(int argc, char **argv) {
+  Ceed          ceed;
+  const CeedInt num_elem = 10, elem_size = 3, num_comp = 2, num_nodes = 2 * num_elem + 1;
+  CeedInt       ind[elem_size * num_elem];
+  bool          orients[elem_size * num_elem];
+  CeedInt8      curl_orients[3 * elem_size * num_elem];
+  CeedScalar    multiplicity[num_nodes];
+  CeedVector    x, z;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_comp * num_nodes, &x);
+  {
+    CeedScalar x_array[num_comp * num_nodes];
+
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) x_array[i] = sin(i + 1.0);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_comp * num_nodes, &z);
+
+  // Elements in a chain share their end nodes, and are listed out of order
+  for (CeedInt i = 0; i < num_nodes; i++) multiplicity[i] = i % 2 == 0 && i > 0 && i < num_nodes - 1 ? 2.0 : 1.0;
+  for (CeedInt k = 0; k < num_elem; k++) {
+    const CeedInt e = (3 * k) % num_elem;
+
+    for (CeedInt i = 0; i < elem_size; i++) {
+      ind[k * elem_size + i]     = 2 * e + i;
+      orients[k * elem_size + i] = (e + i) % 2;
+    }
+    for (CeedInt i = 0; i < 3 * elem_size; i++) curl_orients[3 * elem_size * k + i] = (i + k) % 3 - 1;
+  }
+
+  for (CeedInt block_size = 1; block_size <= 4; block_size += 3) {
+    CeedElemRestriction elem_restriction, elem_restriction_oriented, elem_restriction_unsigned, elem_restriction_curl_oriented,
+        elem_restriction_unoriented;
+    CeedVector y;
+
+    // Blocks of 4 elements leave padding elements in the last block
+    CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST,
+                                     CEED_USE_POINTER, ind, &elem_restriction);
+    CeedElemRestrictionCreateBlockedOriented(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST,
+                                             CEED_USE_POINTER, ind, orients, &elem_restriction_oriented);
+    CeedElemRestrictionCreateUnsignedCopy(elem_restriction_oriented, &elem_restriction_unsigned);
+    CeedElemRestrictionCreateBlockedCurlOriented(ceed, num_elem, elem_size, block_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST,
+                                                 CEED_USE_POINTER, ind, curl_orients, &elem_restriction_curl_oriented);
+    CeedElemRestrictionCreateUnorientedCopy(elem_restriction_curl_oriented, &elem_restriction_unoriented);
+    CeedElemRestrictionCreateVector(elem_restriction, NULL, &y);
+
+    CheckTransposeRestrict(elem_restriction, "standard", num_nodes, num_comp, multiplicity, x, y, z);
+    CheckTransposeRestrict(elem_restriction_oriented, "oriented", num_nodes, num_comp, multiplicity, x, y, z);
+    CheckTransposeRestrict(elem_restriction_unsigned, "unsigned", num_nodes, num_comp, multiplicity, x, y, z);
+    CheckTransposeRestrict(elem_restriction_unoriented, "unoriented", num_nodes, num_comp, multiplicity, x, y, z);
+
+    CeedVectorDestroy(&y);
+    CeedElemRestrictionDestroy(&elem_restriction);
+    CeedElemRestrictionDestroy(&elem_restriction_oriented);
+    CeedElemRestrictionDestroy(&elem_restriction_unsigned);
+    CeedElemRestrictionDestroy(&elem_restriction_curl_oriented);
+    CeedElemRestrictionDestroy(&elem_restriction_unoriented);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&z);
+  CeedDestroy(&ceed);
+  return 0;
+}
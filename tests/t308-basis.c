@@ -0,0 +1,71 @@
+/// @file
+/// Test tensor contractions with sizes that are not multiples of the vector width against the reference backend
+/// \test Test tensor contractions with sizes that are not multiples of the vector width against the reference backend
+
+//TESTARGS(only="cpu") {ceed_resource}
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Sizes cover full register tiles and every remainder for vector widths up to 16
+#define MAX_C 35
+#define MAX_J 35
+
+int main(int argc, char **argv) {
+  Ceed               ceed, ceed_ref;
+  CeedTensorContract contract, contract_ref;
+  const CeedInt      A_values[] = {1, 2, 9}, B_values[] = {1, 3};
+  const CeedInt      max_size = 9 * MAX_C * (MAX_J > 3 ? MAX_J : 3);
+  CeedScalar        *t, *u, *v, *v_ref;
+
+  CeedInit(argv[1], &ceed);
+  CeedInit("/cpu/self/ref/serial", &ceed_ref);
+  CeedTensorContractCreate(ceed, &contract);
+  CeedTensorContractCreate(ceed_ref, &contract_ref);
+
+  t     = malloc(sizeof(CeedScalar) * 3 * MAX_J);
+  u     = malloc(sizeof(CeedScalar) * max_size);
+  v     = malloc(sizeof(CeedScalar) * max_size);
+  v_ref = malloc(sizeof(CeedScalar) * max_size);
+  for (CeedInt i = 0; i < 3 * MAX_J; i++) t[i] = sin(0.7 * i + 0.3);
+  for (CeedInt i = 0; i < max_size; i++) u[i] = cos(1.3 * i + 0.1);
+
+  for (CeedInt a = 0; a < 3; a++) {
+    for (CeedInt b = 0; b < 2; b++) {
+      for (CeedInt C = 1; C <= MAX_C; C++) {
+        for (CeedInt J = 1; J <= MAX_J; J++) {
+          for (CeedInt mode = 0; mode < 4; mode++) {
+            const CeedInt           A = A_values[a], B = B_values[b], add = mode / 2;
+            const CeedTransposeMode t_mode = mode % 2 ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+
+            // Distinct initial output, so accumulation and overwriting are both checked
+            for (CeedInt i = 0; i < A * J * C; i++) v[i] = v_ref[i] = 0.5 * i;
+            CeedTensorContractApply(contract, A, B, C, J, t, t_mode, add, u, v);
+            CeedTensorContractApply(contract_ref, A, B, C, J, t, t_mode, add, u, v_ref);
+            for (CeedInt i = 0; i < A * J * C; i++) {
+              if (fabs(v[i] - v_ref[i]) > 100 * CEED_EPSILON * (1 + fabs(v_ref[i]))) {
+                // LCOV_EXCL_START
+                printf("A %" CeedInt_FMT ", B %" CeedInt_FMT ", C %" CeedInt_FMT ", J %" CeedInt_FMT ", %s%s: v[%" CeedInt_FMT "] %f != %f\n", A, B,
+                       C, J, t_mode == CEED_TRANSPOSE ? "transpose" : "no transpose", add ? ", add" : "", i, v[i], v_ref[i]);
+                // LCOV_EXCL_STOP
+                break;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  free(t);
+  free(u);
+  free(v);
+  free(v_ref);
+  CeedTensorContractDestroy(&contract);
+  CeedTensorContractDestroy(&contract_ref);
+  CeedDestroy(&ceed);
+  CeedDestroy(&ceed_ref);
+  return 0;
+}
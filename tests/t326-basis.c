@@ -0,0 +1,64 @@
+/// @file
+/// Test projection between more pairs of bases than the projection cache holds
+/// \test Test projection between more pairs of bases than the projection cache holds
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+#define MAX_P 8
+
+// Check that the projection matrix from the current Ceed matches the one from a fresh Ceed
+static void CheckProjection(Ceed ceed, Ceed ceed_fresh, CeedInt p_from, CeedInt p_to, CeedInt q) {
+  CeedBasis         basis_from, basis_to, basis_project, basis_project_fresh;
+  const CeedScalar *interp, *interp_fresh, *grad, *grad_fresh;
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, p_from, q, CEED_GAUSS, &basis_from);
+  CeedBasisCreateTensorH1Lagrange(ceed, 2, 1, p_to, q, CEED_GAUSS, &basis_to);
+  CeedBasisCreateProjection(basis_from, basis_to, &basis_project);
+  CeedBasisDestroy(&basis_from);
+  CeedBasisDestroy(&basis_to);
+  CeedBasisCreateTensorH1Lagrange(ceed_fresh, 2, 1, p_from, q, CEED_GAUSS, &basis_from);
+  CeedBasisCreateTensorH1Lagrange(ceed_fresh, 2, 1, p_to, q, CEED_GAUSS, &basis_to);
+  CeedBasisCreateProjection(basis_from, basis_to, &basis_project_fresh);
+
+  CeedBasisGetInterp1D(basis_project, &interp);
+  CeedBasisGetInterp1D(basis_project_fresh, &interp_fresh);
+  CeedBasisGetGrad1D(basis_project, &grad);
+  CeedBasisGetGrad1D(basis_project_fresh, &grad_fresh);
+  for (CeedInt i = 0; i < p_from * p_to; i++) {
+    if (fabs(interp[i] - interp_fresh[i]) > 100 * CEED_EPSILON || fabs(grad[i] - grad_fresh[i]) > 100 * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("Projection from P=%" CeedInt_FMT " to P=%" CeedInt_FMT " differs from fresh projection at entry %" CeedInt_FMT "\n", p_from, p_to, i);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  CeedBasisDestroy(&basis_from);
+  CeedBasisDestroy(&basis_to);
+  CeedBasisDestroy(&basis_project);
+  CeedBasisDestroy(&basis_project_fresh);
+}
+
+int main(int argc, char **argv) {
+  Ceed ceed;
+
+  CeedInit(argv[1], &ceed);
+
+  // Project between every pair of orders twice, so entries are evicted and recomputed
+  for (CeedInt pass = 0; pass < 2; pass++) {
+    for (CeedInt p_from = 2; p_from <= MAX_P; p_from++) {
+      for (CeedInt p_to = p_from; p_to <= MAX_P; p_to++) {
+        Ceed ceed_fresh;
+
+        CeedInit(argv[1], &ceed_fresh);
+        CheckProjection(ceed, ceed_fresh, p_from, p_to, MAX_P);
+        CeedDestroy(&ceed_fresh);
+      }
+    }
+    // Repeat a recently used projection, which is found in the cache
+    CheckProjection(ceed, ceed, MAX_P - 1, MAX_P, MAX_P);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,55 @@
+/// @file
+/// Test tensor contraction with few and many columns agree
+/// \test Test tensor contraction with few and many columns agree
+
+// Backends may specialize the tensor contraction on the sizes, such as the fixed size kernels for few columns in /cpu/self/opt
+//TESTARGS(only="cpu") {ceed_resource}
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <math.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed               ceed;
+  CeedTensorContract contract;
+  const CeedInt      A = 3, P = 4, Q = 5, C = 3, num_copies = 4;
+  CeedScalar         t[Q * P], u[A * Q * C], u_wide[A * Q * C * num_copies], v[A * Q * C], v_wide[A * Q * C * num_copies];
+
+  CeedInit(argv[1], &ceed);
+  CeedTensorContractCreate(ceed, &contract);
+
+  for (CeedInt i = 0; i < Q * P; i++) t[i] = sin(i + 1.0);
+  for (CeedInt i = 0; i < A * Q * C; i++) u[i] = cos(i + 1.0);
+  // Wide input repeats each column of u num_copies times
+  for (CeedInt i = 0; i < A * Q; i++) {
+    for (CeedInt c = 0; c < C * num_copies; c++) u_wide[i * C * num_copies + c] = u[i * C + c % C];
+  }
+
+  for (CeedInt t_mode = CEED_NOTRANSPOSE; t_mode <= CEED_TRANSPOSE; t_mode++) {
+    // t is Q x P, so the contracted and output sizes swap in transpose mode
+    const CeedInt B = t_mode == CEED_TRANSPOSE ? Q : P, J = t_mode == CEED_TRANSPOSE ? P : Q;
+
+    for (CeedInt add = 0; add <= 1; add++) {
+      for (CeedInt i = 0; i < A * J * C; i++) v[i] = 1.0;
+      for (CeedInt i = 0; i < A * J * C * num_copies; i++) v_wide[i] = 1.0;
+      CeedTensorContractApply(contract, A, B, C, J, t, (CeedTransposeMode)t_mode, add, u, v);
+      CeedTensorContractApply(contract, A, B, C * num_copies, J, t, (CeedTransposeMode)t_mode, add, u_wide, v_wide);
+      for (CeedInt i = 0; i < A * J; i++) {
+        for (CeedInt c = 0; c < C * num_copies; c++) {
+          const CeedScalar v_few = v[i * C + c % C], v_many = v_wide[i * C * num_copies + c];
+
+          if (fabs(v_few - v_many) > 100. * CEED_EPSILON) {
+            // LCOV_EXCL_START
+            printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] t_mode %" CeedInt_FMT " add %" CeedInt_FMT ": %f != %f\n", i, c, t_mode, add, v_few,
+                   v_many);
+            // LCOV_EXCL_STOP
+          }
+        }
+      }
+    }
+  }
+
+  CeedTensorContractDestroy(&contract);
+  CeedDestroy(&ceed);
+  return 0;
+}
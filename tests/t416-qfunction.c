@@ -0,0 +1,95 @@
+/// @file
+/// Test QFunction with writable context and context data reduction
+/// \test Test QFunction with writable context and context data reduction
+
+// Context updates in the QFunction are not atomic, so GPU backends would race on the context fields
+//TESTARGS(only="cpu") {ceed_resource}
+#include "t416-qfunction.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+static int reduce(void *data, const void *thread_data, const void *initial_data) {
+  ScaleContext       *context         = (ScaleContext *)data;
+  const ScaleContext *thread_context  = (const ScaleContext *)thread_data;
+  const ScaleContext *initial_context = (const ScaleContext *)initial_data;
+
+  context->sum += thread_context->sum - initial_context->sum;
+  context->num_points += thread_context->num_points - initial_context->num_points;
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  Ceed                 ceed;
+  CeedVector           u, v;
+  CeedQFunction        qf_scale;
+  CeedQFunctionContext ctx;
+  CeedInt              q         = 2048;
+  CeedScalar           sum_true  = 0;
+  ScaleContext         scale_ctx = {.scale = 3, .sum = 1, .num_points = 0};
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, 2 * q, &u);
+  {
+    CeedScalar u_array[2 * q];
+
+    for (CeedInt i = 0; i < 2 * q; i++) {
+      u_array[i] = (i % 7) - 3 + 0.5 * (i / q);
+      sum_true += u_array[i];
+    }
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, 2 * q, &v);
+  CeedVectorSetValue(v, 0);
+
+  CeedQFunctionContextCreate(ceed, &ctx);
+  CeedQFunctionContextSetData(ctx, CEED_MEM_HOST, CEED_COPY_VALUES, sizeof(scale_ctx), &scale_ctx);
+  CeedQFunctionContextSetDataReduce(ctx, reduce);
+
+  CeedQFunctionCreateInterior(ceed, 1, scale, scale_loc, &qf_scale);
+  CeedQFunctionAddInput(qf_scale, "u", 2, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_scale, "v", 2, CEED_EVAL_INTERP);
+  CeedQFunctionSetContext(qf_scale, ctx);
+  CeedQFunctionSetContextWritable(qf_scale, true);
+
+  // Apply twice to check accumulation in the context data
+  for (CeedInt k = 0; k < 2; k++) CeedQFunctionApply(qf_scale, q, &u, &v);
+
+  // Verify results
+  {
+    const CeedScalar *u_array, *v_array;
+
+    CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < 2 * q; i++) {
+      if (fabs(3 * u_array[i] - v_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] v %f != 3 * u %f\n", i, v_array[i], 3 * u_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(u, &u_array);
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+  {
+    const ScaleContext *ctx_data;
+
+    CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, &ctx_data);
+    if (fabs(ctx_data->sum - (1 + 2 * sum_true)) > 100. * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("Context sum %f != %f\n", ctx_data->sum, 1 + 2 * sum_true);
+      // LCOV_EXCL_STOP
+    }
+    if (ctx_data->num_points != 2 * q) printf("Context points %" CeedInt_FMT " != %" CeedInt_FMT "\n", ctx_data->num_points, 2 * q);
+    CeedQFunctionContextRestoreDataRead(ctx, &ctx_data);
+  }
+
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedQFunctionDestroy(&qf_scale);
+  CeedQFunctionContextDestroy(&ctx);
+  CeedDestroy(&ceed);
+  return 0;
+}
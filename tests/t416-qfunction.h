@@ -0,0 +1,30 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+
+typedef struct {
+  CeedScalar scale;
+  CeedScalar sum;
+  CeedInt    num_points;
+} ScaleContext;
+
+// Accumulates into the context without synchronization; only valid for backends that apply a QFunction on one thread or reduce private copies
+CEED_QFUNCTION(scale)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  ScaleContext     *context = (ScaleContext *)ctx;
+  const CeedScalar *u       = in[0];
+  CeedScalar       *v       = out[0];
+
+  for (CeedInt c = 0; c < 2; c++) {
+    for (CeedInt i = 0; i < Q; i++) {
+      v[i + c * Q] = context->scale * u[i + c * Q];
+      context->sum += u[i + c * Q];
+    }
+  }
+  context->num_points += Q;
+  return 0;
+}
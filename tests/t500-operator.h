@@ -24,3 +24,20 @@ CEED_QFUNCTION(mass)(void *ctx, const CeedInt Q, const CeedScalar *const *in, Ce
   }
   return 0;
 }
+
+// Host-only test helpers, skipped when this file is JiT compiled for GPU backends
+#if !defined(__CUDACC_RTC__) && !defined(__HIPCC_RTC__)
+#include <stdio.h>
+#include <string.h>
+
+// Check that a line of a file contains a string
+static inline int FileContains(FILE *file, const char *string) {
+  char line[1024];
+
+  rewind(file);
+  while (fgets(line, sizeof(line), file)) {
+    if (strstr(line, string)) return 1;
+  }
+  return 0;
+}
+#endif
@@ -0,0 +1,193 @@
+/// @file
+/// Test mass and Poisson operator with the same field evaluated as values and gradients
+/// \test Test mass and Poisson operator with the same field evaluated as values and gradients
+#include "t512-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data_mass, elem_restriction_q_data_diff;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup_mass, qf_setup_diff, qf_mass, qf_diff, qf_mass_diff;
+  CeedOperator        op_setup_mass, op_setup_diff, op_mass, op_diff, op_mass_diff;
+  CeedVector          q_data_mass, q_data_diff, x, u, v, v_sum;
+  CeedInt             num_elem = 6, p = 3, q = 4, dim = 2;
+  CeedInt             nx = 3, ny = 2;
+  CeedInt             num_dofs = (nx * 2 + 1) * (ny * 2 + 1), num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < nx * 2 + 1; i++) {
+      for (CeedInt j = 0; j < ny * 2 + 1; j++) {
+        x_array[i + j * (nx * 2 + 1) + 0 * num_dofs] = (CeedScalar)i / (2 * nx);
+        x_array[i + j * (nx * 2 + 1) + 1 * num_dofs] = (CeedScalar)j / (2 * ny);
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &u);
+  {
+    CeedScalar u_array[num_dofs];
+
+    for (CeedInt i = 0; i < num_dofs; i++) u_array[i] = 1.0 + sin((CeedScalar)i);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_dofs, &v_sum);
+  CeedVectorCreate(ceed, num_qpts, &q_data_mass);
+  CeedVectorCreate(ceed, num_qpts * dim * (dim + 1) / 2, &q_data_diff);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    CeedInt col, row, offset;
+    col    = i % nx;
+    row    = i / nx;
+    offset = col * (p - 1) + row * (nx * 2 + 1) * (p - 1);
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt k = 0; k < p; k++) ind_x[p * (p * i + k) + j] = offset + k * (nx * 2 + 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data_mass[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data_mass, &elem_restriction_q_data_mass);
+
+  CeedInt strides_q_data_diff[3] = {1, q * q, q * q * dim * (dim + 1) / 2};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, dim * (dim + 1) / 2, dim * (dim + 1) / 2 * num_qpts, strides_q_data_diff,
+                                   &elem_restriction_q_data_diff);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunction - setup mass
+  CeedQFunctionCreateInterior(ceed, 1, setup_mass, setup_mass_loc, &qf_setup_mass);
+  CeedQFunctionAddInput(qf_setup_mass, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup_mass, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup_mass, "q data", 1, CEED_EVAL_NONE);
+
+  // Operator - setup mass
+  CeedOperatorCreate(ceed, qf_setup_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_mass);
+  CeedOperatorSetField(op_setup_mass, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_mass, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_mass, "q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  // QFunction - setup diff
+  CeedQFunctionCreateInterior(ceed, 1, setup_diff, setup_diff_loc, &qf_setup_diff);
+  CeedQFunctionAddInput(qf_setup_diff, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddInput(qf_setup_diff, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddOutput(qf_setup_diff, "q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+
+  // Operator - setup diff
+  CeedOperatorCreate(ceed, qf_setup_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup_diff);
+  CeedOperatorSetField(op_setup_diff, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup_diff, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup_diff, "q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operators
+  CeedOperatorApply(op_setup_mass, x, q_data_mass, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_setup_diff, x, q_data_diff, CEED_REQUEST_IMMEDIATE);
+
+  // QFunction - mass
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operator - mass
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, q_data_mass);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // QFunction - diff
+  CeedQFunctionCreateInterior(ceed, 1, diff, diff_loc, &qf_diff);
+  CeedQFunctionAddInput(qf_diff, "q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_diff, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_diff, "dv", dim, CEED_EVAL_GRAD);
+
+  // Operator - diff
+  CeedOperatorCreate(ceed, qf_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_diff);
+  CeedOperatorSetField(op_diff, "q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, q_data_diff);
+  CeedOperatorSetField(op_diff, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_diff, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // QFunction - mass and diff, gradient output before value output
+  CeedQFunctionCreateInterior(ceed, 1, mass_diff, mass_diff_loc, &qf_mass_diff);
+  CeedQFunctionAddInput(qf_mass_diff, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_mass_diff, "mass q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass_diff, "diff q data", dim * (dim + 1) / 2, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass_diff, "du", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_mass_diff, "dv", dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_mass_diff, "v", 1, CEED_EVAL_INTERP);
+
+  // Operator - mass and diff
+  CeedOperatorCreate(ceed, qf_mass_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_diff);
+  CeedOperatorSetField(op_mass_diff, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_diff, "mass q data", elem_restriction_q_data_mass, CEED_BASIS_NONE, q_data_mass);
+  CeedOperatorSetField(op_mass_diff, "diff q data", elem_restriction_q_data_diff, CEED_BASIS_NONE, q_data_diff);
+  CeedOperatorSetField(op_mass_diff, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_diff, "dv", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_diff, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply separate operators
+  CeedOperatorApply(op_mass, u, v_sum, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_diff, u, v_sum, CEED_REQUEST_IMMEDIATE);
+
+  // Apply combined operator
+  CeedOperatorApply(op_mass_diff, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_sum_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_sum, CEED_MEM_HOST, &v_sum_array);
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(v_array[i] - v_sum_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in combined operator: %f != %f\n", i, v_array[i], v_sum_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_sum, &v_sum_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_sum);
+  CeedVectorDestroy(&q_data_mass);
+  CeedVectorDestroy(&q_data_diff);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data_mass);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data_diff);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup_mass);
+  CeedQFunctionDestroy(&qf_setup_diff);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_diff);
+  CeedQFunctionDestroy(&qf_mass_diff);
+  CeedOperatorDestroy(&op_setup_mass);
+  CeedOperatorDestroy(&op_setup_diff);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_diff);
+  CeedOperatorDestroy(&op_mass_diff);
+  CeedDestroy(&ceed);
+  return 0;
+}
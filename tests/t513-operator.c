@@ -0,0 +1,150 @@
+/// @file
+/// Test profiling of mass matrix operator application, with hardware counters
+/// \test Test profiling of mass matrix operator application, with hardware counters
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedScalar          x_array[num_nodes_x];
+  char                trace_file_name[256] = "t513-profile";
+
+  CeedInit(argv[1], &ceed);
+
+  // Profile to a trace file unique to the backend
+  for (size_t i = 0, j = strlen(trace_file_name); argv[1][i] && j < sizeof(trace_file_name) - 6; i++) {
+    if (argv[1][i] != '/' && argv[1][i] != ':') trace_file_name[j++] = argv[1][i];
+    else if (trace_file_name[j - 1] != '-') trace_file_name[j++] = '-';
+    trace_file_name[j] = '\0';
+  }
+  strcat(trace_file_name, ".json");
+  CeedSetProfiling(ceed, true);
+  CeedSetProfilingTraceFile(ceed, trace_file_name);
+  {
+    bool is_profiling;
+
+    CeedIsProfiling(ceed, &is_profiling);
+    if (!is_profiling) printf("Profiling not enabled\n");
+  }
+
+  for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetName(op_setup, "setup");
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetName(op_mass, "mass \"1D\"");
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorSetValue(u, 1.0);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  for (CeedInt i = 0; i < 3; i++) CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Check summary
+  {
+    FILE *file = tmpfile();
+
+    CeedProfilingView(ceed, file);
+    if (!FileContains(file, "CeedOperatorApply")) printf("Summary missing CeedOperatorApply\n");
+    if (!FileContains(file, "mass \"1D\"")) printf("Summary missing operator name\n");
+    fclose(file);
+  }
+
+  // Check hardware counters, which may be unavailable
+  CeedSetProfilingCounters(ceed, true);
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    FILE *file = tmpfile();
+
+    CeedProfilingView(ceed, file);
+    if (!FileContains(file, "Hardware counters")) printf("Summary missing hardware counters\n");
+    if (!FileContains(file, "(transpose)")) printf("Summary missing transpose restriction\n");
+    fclose(file);
+  }
+  CeedSetProfilingCounters(ceed, false);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+
+  // Check trace written on destroy
+  {
+    FILE *file = fopen(trace_file_name, "r");
+
+    if (!file) {
+      // LCOV_EXCL_START
+      printf("Trace file %s not written\n", trace_file_name);
+      return 1;
+      // LCOV_EXCL_STOP
+    }
+    if (!FileContains(file, "\"traceEvents\"")) printf("Trace missing event list\n");
+    if (!FileContains(file, "\"name\": \"mass \\\"1D\\\"\", \"cat\": \"CeedOperatorApply\"")) printf("Trace missing mass operator event\n");
+    if (!FileContains(file, "\"name\": \"setup\", \"cat\": \"CeedOperatorApply\"")) printf("Trace missing setup operator event\n");
+    fclose(file);
+    remove(trace_file_name);
+  }
+  return 0;
+}
@@ -0,0 +1,143 @@
+/// @file
+/// Test memory traffic estimate and performance view of mass matrix operator
+/// \test Test memory traffic estimate and performance view of mass matrix operator
+#include <ceed.h>
+#include <stdio.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass, op_composite;
+  CeedVector          q_data, x, u, v;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedScalar          x_array[num_nodes_x];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+  CeedQFunctionSetUserFlopsEstimate(qf_mass, 1);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetName(op_mass, "mass");
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass);
+
+  // Check memory traffic estimate
+  {
+    const CeedSize num_q = num_elem * q, num_e = num_elem * p;
+    // rho: L-vector read, E-vector written, and Q-vector read by the QFunction
+    // u: L-vector and offsets read, E-vector written and read, Q-vector written and read
+    // v: Q-vector written and read, E-vector written and read, L-vector read and written, and offsets read
+    const CeedSize num_scalars    = 3 * num_q + (2 * num_e + 2 * num_q + num_nodes_u) + (2 * num_q + 2 * num_e + 2 * num_nodes_u);
+    const CeedSize expected_bytes = num_scalars * sizeof(CeedScalar) + 2 * num_e * sizeof(CeedInt);
+    CeedSize       bytes, composite_bytes;
+
+    CeedOperatorGetMemoryTrafficEstimate(op_mass, &bytes);
+    if (bytes != expected_bytes) {
+      // LCOV_EXCL_START
+      printf("Incorrect memory traffic estimate computed, %" CeedSize_FMT " != %" CeedSize_FMT "\n", bytes, expected_bytes);
+      // LCOV_EXCL_STOP
+    }
+    CeedOperatorGetMemoryTrafficEstimate(op_composite, &composite_bytes);
+    if (composite_bytes != bytes) {
+      // LCOV_EXCL_START
+      printf("Incorrect composite memory traffic estimate computed, %" CeedSize_FMT " != %" CeedSize_FMT "\n", composite_bytes, bytes);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorSetValue(u, 1.0);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+
+  // No performance reported without profiling
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    FILE *file = tmpfile();
+
+    CeedOperatorView(op_mass, file);
+    if (FileContains(file, "Last application")) printf("View reports performance without profiling\n");
+    fclose(file);
+  }
+
+  // Performance of last application reported with profiling
+  CeedSetProfiling(ceed, true);
+  CeedOperatorApply(op_composite, u, v, CEED_REQUEST_IMMEDIATE);
+  {
+    FILE *file = tmpfile();
+
+    CeedOperatorView(op_composite, file);
+    if (!FileContains(file, "Last application")) printf("View missing last application time\n");
+    if (!FileContains(file, "GB/s")) printf("View missing achieved bandwidth\n");
+    if (!FileContains(file, "GFLOP/s")) printf("View missing achieved GFLOP/s\n");
+    if (!FileContains(file, "FLOPs/byte")) printf("View missing arithmetic intensity\n");
+    fclose(file);
+  }
+  CeedSetProfiling(ceed, false);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
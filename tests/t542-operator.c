@@ -0,0 +1,114 @@
+/// @file
+/// Test creation and use of FDM element inverse for a multi-component 3D operator
+/// \test Test creation and use of FDM element inverse for a multi-component 3D operator
+#include "t542-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_u;
+  CeedQFunction       qf_apply;
+  CeedOperator        op_apply, op_inverse;
+  CeedVector          q_data_mass, q_weight, u, v, w;
+  CeedInt             num_elem = 3, p = 3, q = 4, dim = 3, num_comp = 2;
+  CeedInt             elem_size = p * p * p, num_qpts_elem = q * q * q;
+  CeedInt             num_dofs = num_elem * num_comp * elem_size, num_qpts = num_elem * num_qpts_elem;
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, num_dofs, &u);
+  {
+    CeedScalar u_array[num_dofs];
+
+    for (CeedInt i = 0; i < num_dofs; i++) u_array[i] = sin(i + 1.0);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_dofs, &w);
+  CeedVectorCreate(ceed, num_qpts_elem, &q_weight);
+  CeedVectorCreate(ceed, num_qpts, &q_data_mass);
+
+  // Restrictions, with discontinuous elements so the element inverses are exact
+  CeedInt strides_u[3] = {1, elem_size, num_comp * elem_size};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, elem_size, num_comp, num_dofs, strides_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, num_qpts_elem, num_qpts_elem};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts_elem, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // Mass quadrature data, with a different scaling on each element
+  CeedBasisApply(basis_u, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_weight);
+  {
+    const CeedScalar *q_weight_array;
+    CeedScalar        q_data_array[num_qpts];
+
+    CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array);
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < num_qpts_elem; i++) q_data_array[e * num_qpts_elem + i] = (e + 1.0) * q_weight_array[i];
+    }
+    CeedVectorRestoreArrayRead(q_weight, &q_weight_array);
+    CeedVectorSetArray(q_data_mass, CEED_MEM_HOST, CEED_COPY_VALUES, q_data_array);
+  }
+
+  // QFunction - apply
+  CeedQFunctionCreateInterior(ceed, 1, apply, apply_loc, &qf_apply);
+  CeedQFunctionAddInput(qf_apply, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_apply, "mass q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_apply, "v", num_comp, CEED_EVAL_INTERP);
+
+  // Operator - apply
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_apply);
+  CeedOperatorSetField(op_apply, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_apply, "mass q data", elem_restriction_q_data, CEED_BASIS_NONE, q_data_mass);
+  CeedOperatorSetField(op_apply, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply original operator
+  CeedOperatorApply(op_apply, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Create FDM element inverse
+  CeedOperatorCreateFDMElementInverse(op_apply, &op_inverse, CEED_REQUEST_IMMEDIATE);
+
+  // Apply FDM element inverse, then add it again
+  CeedOperatorApply(op_inverse, v, w, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_inverse, v, w, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *u_array, *w_array;
+
+    CeedVectorGetArrayRead(u, CEED_MEM_HOST, &u_array);
+    CeedVectorGetArrayRead(w, CEED_MEM_HOST, &w_array);
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      if (fabs(w_array[i] - 2.0 * u_array[i]) > 1000. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Error in inverse: %e != 2 * %e\n", i, w_array[i], u_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(u, &u_array);
+    CeedVectorRestoreArrayRead(w, &w_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&q_data_mass);
+  CeedVectorDestroy(&q_weight);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&w);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_apply);
+  CeedOperatorDestroy(&op_inverse);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,26 @@
+// Copyright (c) 2017-2024, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+
+CEED_QFUNCTION(apply)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  // in[0] is u, size (2*Q)
+  // in[1] is mass quadrature data, size (Q)
+  const CeedScalar *u = in[0], *qd_mass = in[1];
+
+  // out[0] is output to multiply against v, size (2*Q)
+  CeedScalar *v = out[0];
+
+  // Quadrature point loop
+  for (CeedInt i = 0; i < Q; i++) {
+    // Mass, for each component
+    v[i + Q * 0] = qd_mass[i] * u[i + Q * 0];
+    v[i + Q * 1] = qd_mass[i] * u[i + Q * 1];
+  }
+
+  return 0;
+}
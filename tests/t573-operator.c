@@ -0,0 +1,194 @@
+/// @file
+/// Test full assembly of mass matrix operator with stored element matrices (see t560)
+/// \test Test full assembly of mass matrix operator with stored element matrices
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t510-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v;
+  CeedInt             p = 3, q = 4, dim = 2;
+  CeedInt             n_x = 3, n_y = 2;
+  CeedInt             num_elem = n_x * n_y;
+  CeedInt             num_dofs = (n_x * 2 + 1) * (n_y * 2 + 1), num_qpts = num_elem * q * q;
+  CeedInt             ind_x[num_elem * p * p];
+  CeedScalar          assembled_values[num_dofs * num_dofs];
+  CeedScalar          assembled_values_csr[num_dofs * num_dofs];
+  CeedScalar          assembled_true[num_dofs * num_dofs];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < n_x * 2 + 1; i++) {
+      for (CeedInt j = 0; j < n_y * 2 + 1; j++) {
+        x_array[i + j * (n_x * 2 + 1) + 0 * num_dofs] = (CeedScalar)i / (2 * n_x);
+        x_array[i + j * (n_x * 2 + 1) + 1 * num_dofs] = (CeedScalar)j / (2 * n_y);
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs, &u);
+  CeedVectorCreate(ceed, num_dofs, &v);
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    CeedInt col, row, offset;
+    col    = i % n_x;
+    row    = i / n_x;
+    offset = col * (p - 1) + row * (n_x * 2 + 1) * (p - 1);
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt k = 0; k < p; k++) ind_x[p * (p * i + k) + j] = offset + k * (n_x * 2 + 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Manually assemble operator
+  CeedVectorSetValue(u, 0.0);
+  for (CeedInt j = 0; j < num_dofs; j++) {
+    CeedScalar       *u_array;
+    const CeedScalar *v_array;
+
+    // Set input
+    CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+    u_array[j] = 1.0;
+    if (j) u_array[j - 1] = 0.0;
+    CeedVectorRestoreArray(u, &u_array);
+
+    // Compute entries for column j
+    CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_dofs; i++) assembled_true[i * num_dofs + j] = v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+  }
+
+  // Fully assemble operator, reusing QFunction data and element matrices
+  CeedSize   num_entries, num_nonzeros;
+  CeedInt   *rows, *cols, *row_ptr, *col_idx;
+  CeedVector assembled, assembled_csr;
+
+  CeedOperatorSetQFunctionAssemblyReuse(op_mass, true);
+  CeedOperatorSetElementMatrixReuse(op_mass, true);
+  CeedOperatorLinearAssembleSymbolic(op_mass, &num_entries, &rows, &cols);
+  CeedOperatorLinearAssembleSymbolicCSR(op_mass, &num_nonzeros, &row_ptr, &col_idx);
+  CeedVectorCreate(ceed, num_entries, &assembled);
+  CeedVectorCreate(ceed, num_nonzeros, &assembled_csr);
+  for (CeedInt update = 0; update < 2; update++) {
+    const CeedScalar scale = update ? 2.0 : 1.0;
+
+    if (update) {
+      // Change QFunction data
+      CeedVectorScale(q_data, 2.0);
+      CeedOperatorSetQFunctionAssemblyDataUpdateNeeded(op_mass, true);
+    }
+    for (CeedInt k = 0; k < 2; k++) {
+      CeedOperatorLinearAssemble(op_mass, assembled);
+      CeedOperatorLinearAssembleCSR(op_mass, assembled_csr);
+    }
+
+    // Check output
+    for (CeedInt k = 0; k < num_dofs * num_dofs; ++k) {
+      assembled_values[k]     = 0.0;
+      assembled_values_csr[k] = 0.0;
+    }
+    {
+      const CeedScalar *assembled_array;
+
+      CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+      for (CeedInt k = 0; k < num_entries; ++k) {
+        assembled_values[rows[k] * num_dofs + cols[k]] += assembled_array[k];
+      }
+      CeedVectorRestoreArrayRead(assembled, &assembled_array);
+      CeedVectorGetArrayRead(assembled_csr, CEED_MEM_HOST, &assembled_array);
+      for (CeedInt i = 0; i < num_dofs; i++) {
+        for (CeedInt k = row_ptr[i]; k < row_ptr[i + 1]; k++) assembled_values_csr[i * num_dofs + col_idx[k]] = assembled_array[k];
+      }
+      CeedVectorRestoreArrayRead(assembled_csr, &assembled_array);
+    }
+    for (CeedInt i = 0; i < num_dofs; i++) {
+      for (CeedInt j = 0; j < num_dofs; j++) {
+        const CeedScalar value_true = scale * assembled_true[i * num_dofs + j];
+
+        if (fabs(assembled_values[i * num_dofs + j] - value_true) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in assembly: %f != %f\n", i, j, assembled_values[i * num_dofs + j], value_true);
+          // LCOV_EXCL_STOP
+        }
+        if (fabs(assembled_values_csr[i * num_dofs + j] - value_true) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in CSR assembly: %f != %f\n", i, j, assembled_values_csr[i * num_dofs + j], value_true);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+  }
+
+  // Cleanup
+  free(rows);
+  free(cols);
+  free(row_ptr);
+  free(col_idx);
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&assembled);
+  CeedVectorDestroy(&assembled_csr);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,191 @@
+/// @file
+/// Test full and diagonal assembly of a vector mass operator with a sparse symmetric coupling between components
+/// \test Test full and diagonal assembly of a vector mass operator with a sparse symmetric coupling between components
+#include "t576-operator.h"
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                 ceed;
+  CeedElemRestriction  elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis            basis_x, basis_u;
+  CeedQFunction        qf_setup, qf_mass;
+  CeedQFunctionContext mass_context;
+  CeedOperator         op_setup, op_mass;
+  CeedVector           q_data, x, assembled, diagonal, u, v;
+  CeedInt              num_elem = 6, p = 3, q = 4, dim = 2, num_comp = 3;
+  CeedInt              n_x = 3, n_y = 2;
+  CeedInt              num_dofs = (n_x * 2 + 1) * (n_y * 2 + 1), num_qpts = num_elem * q * q;
+  CeedInt              ind_x[num_elem * p * p];
+  CeedInt             *rows, *cols;
+  CeedSize             num_entries;
+  CeedScalar           coupling = 0.0;
+  CeedScalar           assembled_full[num_comp * num_dofs][num_comp * num_dofs], assembled_full_true[num_comp * num_dofs][num_comp * num_dofs];
+
+  CeedInit(argv[1], &ceed);
+
+  // Vectors
+  CeedVectorCreate(ceed, dim * num_dofs, &x);
+  {
+    CeedScalar x_array[dim * num_dofs];
+
+    for (CeedInt i = 0; i < n_x * (p - 1) + 1; i++) {
+      for (CeedInt j = 0; j < n_y * (p - 1) + 1; j++) {
+        x_array[i + j * (n_x * (p - 1) + 1) + 0 * num_dofs] = (CeedScalar)i / ((p - 1) * n_x);
+        x_array[i + j * (n_x * (p - 1) + 1) + 1 * num_dofs] = (CeedScalar)j / ((p - 1) * n_y);
+      }
+    }
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_qpts, &q_data);
+  CeedVectorCreate(ceed, num_comp * num_dofs, &u);
+  CeedVectorCreate(ceed, num_comp * num_dofs, &v);
+  CeedVectorCreate(ceed, num_comp * num_dofs, &diagonal);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    CeedInt col, row, offset;
+    col    = i % n_x;
+    row    = i / n_x;
+    offset = col * (p - 1) + row * (n_x * 2 + 1) * (p - 1);
+    for (CeedInt j = 0; j < p; j++) {
+      for (CeedInt k = 0; k < p; k++) ind_x[p * (p * i + k) + j] = offset + k * (n_x * 2 + 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, dim, num_dofs, dim * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+  CeedElemRestrictionCreate(ceed, num_elem, p * p, num_comp, num_dofs, num_comp * num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_x,
+                            &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q * q, q * q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q * q, 1, num_qpts, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, p, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", dim * dim, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", num_comp, CEED_EVAL_INTERP);
+
+  CeedQFunctionContextCreate(ceed, &mass_context);
+  CeedQFunctionContextSetData(mass_context, CEED_MEM_HOST, CEED_COPY_VALUES, sizeof(coupling), &coupling);
+  CeedQFunctionSetContext(qf_mass, mass_context);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  // Apply Setup Operator
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Assemble with the third component uncoupled, then with all components coupled
+  CeedOperatorLinearAssembleSymbolic(op_mass, &num_entries, &rows, &cols);
+  CeedVectorCreate(ceed, num_entries, &assembled);
+  for (CeedInt k = 0; k < 2; k++) {
+    if (k == 1) {
+      CeedScalar *coupling_data;
+
+      CeedQFunctionContextGetData(mass_context, CEED_MEM_HOST, &coupling_data);
+      coupling_data[0] = 0.5;
+      CeedQFunctionContextRestoreData(mass_context, &coupling_data);
+    }
+
+    // Assemble full matrix and diagonal
+    CeedOperatorLinearAssemble(op_mass, assembled);
+    CeedOperatorLinearAssembleDiagonal(op_mass, diagonal, CEED_REQUEST_IMMEDIATE);
+    for (CeedInt i = 0; i < num_comp * num_dofs; i++) {
+      for (CeedInt j = 0; j < num_comp * num_dofs; j++) assembled_full[i][j] = 0.0;
+    }
+    {
+      const CeedScalar *assembled_array;
+
+      CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array);
+      for (CeedSize i = 0; i < num_entries; i++) assembled_full[rows[i]][cols[i]] += assembled_array[i];
+      CeedVectorRestoreArrayRead(assembled, &assembled_array);
+    }
+
+    // Manually assemble operator
+    CeedVectorSetValue(u, 0.0);
+    for (CeedInt j = 0; j < num_comp * num_dofs; j++) {
+      CeedScalar       *u_array;
+      const CeedScalar *v_array;
+
+      // Set input
+      CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+      u_array[j] = 1.0;
+      if (j) u_array[j - 1] = 0.0;
+      CeedVectorRestoreArray(u, &u_array);
+
+      // Compute entries for column j
+      CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+      CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+      for (CeedInt i = 0; i < num_comp * num_dofs; i++) assembled_full_true[i][j] = v_array[i];
+      CeedVectorRestoreArrayRead(v, &v_array);
+    }
+
+    // Check output
+    for (CeedInt i = 0; i < num_comp * num_dofs; i++) {
+      for (CeedInt j = 0; j < num_comp * num_dofs; j++) {
+        if (fabs(assembled_full[i][j] - assembled_full_true[i][j]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT ", %" CeedInt_FMT "] Error in full assembly k=%d: %f != %f\n", i, j, (int)k, assembled_full[i][j],
+                 assembled_full_true[i][j]);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    {
+      const CeedScalar *diagonal_array;
+
+      CeedVectorGetArrayRead(diagonal, CEED_MEM_HOST, &diagonal_array);
+      for (CeedInt i = 0; i < num_comp * num_dofs; i++) {
+        if (fabs(diagonal_array[i] - assembled_full_true[i][i]) > 100. * CEED_EPSILON) {
+          // LCOV_EXCL_START
+          printf("[%" CeedInt_FMT "] Error in diagonal assembly: %f != %f\n", i, diagonal_array[i], assembled_full_true[i][i]);
+          // LCOV_EXCL_STOP
+        }
+      }
+      CeedVectorRestoreArrayRead(diagonal, &diagonal_array);
+    }
+  }
+
+  // Cleanup
+  free(rows);
+  free(cols);
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&assembled);
+  CeedVectorDestroy(&diagonal);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionContextDestroy(&mass_context);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,96 @@
+/// @file
+/// Test nonzero pattern of composite operator with many elements in each sub-operator
+/// \test Test nonzero pattern of composite operator with many elements in each sub-operator
+#include <ceed.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restrictions_u[3];
+  CeedBasis           basis_u;
+  CeedQFunction       qf_identity;
+  CeedOperator        ops_identity[3], op_composite;
+  CeedInt             p = 3, q = 4, num_elem = 700, num_dofs = num_elem * (p - 1) + 1;
+  CeedInt             num_elem_sub[3] = {num_elem, 300, 5}, first_elem_sub[3] = {0, 350, 123};
+  CeedInt            *ind_u[3];
+
+  CeedInit(argv[1], &ceed);
+
+  // Restrictions on overlapping ranges of elements
+  for (CeedInt k = 0; k < 3; k++) {
+    ind_u[k] = malloc(num_elem_sub[k] * p * sizeof(CeedInt));
+    for (CeedInt i = 0; i < num_elem_sub[k]; i++) {
+      for (CeedInt j = 0; j < p; j++) ind_u[k][p * i + j] = (first_elem_sub[k] + i) * (p - 1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem_sub[k], p, 1, 1, num_dofs, CEED_MEM_HOST, CEED_USE_POINTER, ind_u[k], &elem_restrictions_u[k]);
+  }
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunction
+  CeedQFunctionCreateIdentity(ceed, 1, CEED_EVAL_INTERP, CEED_EVAL_INTERP, &qf_identity);
+
+  // Operators
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  for (CeedInt k = 0; k < 3; k++) {
+    CeedOperatorCreate(ceed, qf_identity, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &ops_identity[k]);
+    CeedOperatorSetField(ops_identity[k], "input", elem_restrictions_u[k], basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(ops_identity[k], "output", elem_restrictions_u[k], basis_u, CEED_VECTOR_ACTIVE);
+    CeedCompositeOperatorAddSub(op_composite, ops_identity[k]);
+  }
+
+  // Assemble nonzero pattern
+  {
+    CeedSize  num_entries, num_entries_64, num_entries_true = 0;
+    CeedInt  *rows, *cols;
+    CeedSize *rows_64, *cols_64;
+
+    CeedOperatorLinearAssembleSymbolic(op_composite, &num_entries, &rows, &cols);
+    CeedOperatorLinearAssembleSymbolic64(op_composite, &num_entries_64, &rows_64, &cols_64);
+    for (CeedInt k = 0; k < 3; k++) num_entries_true += num_elem_sub[k] * p * p;
+    if (num_entries != num_entries_true || num_entries_64 != num_entries_true) {
+      // LCOV_EXCL_START
+      printf("Incorrect number of entries: %" CeedSize_FMT ", %" CeedSize_FMT " != %" CeedSize_FMT "\n", num_entries, num_entries_64,
+             num_entries_true);
+      // LCOV_EXCL_STOP
+    }
+
+    // Check entries, in sub-operator and element order
+    CeedSize count = 0;
+
+    for (CeedInt k = 0; k < 3 && num_entries == num_entries_true; k++) {
+      for (CeedInt e = 0; e < num_elem_sub[k]; e++) {
+        for (CeedInt i = 0; i < p; i++) {
+          for (CeedInt j = 0; j < p; j++, count++) {
+            const CeedInt row = ind_u[k][p * e + i], col = ind_u[k][p * e + j];
+
+            if (rows[count] != row || cols[count] != col || rows_64[count] != row || cols_64[count] != col) {
+              // LCOV_EXCL_START
+              printf("[%" CeedSize_FMT "] Error in symbolic assembly: (%" CeedInt_FMT ", %" CeedInt_FMT ") != (%" CeedInt_FMT ", %" CeedInt_FMT ")\n",
+                     count, rows[count], cols[count], row, col);
+              // LCOV_EXCL_STOP
+            }
+          }
+        }
+      }
+    }
+    free(rows);
+    free(cols);
+    free(rows_64);
+    free(cols_64);
+  }
+
+  // Cleanup
+  for (CeedInt k = 0; k < 3; k++) {
+    CeedElemRestrictionDestroy(&elem_restrictions_u[k]);
+    CeedOperatorDestroy(&ops_identity[k]);
+    free(ind_u[k]);
+  }
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_identity);
+  CeedOperatorDestroy(&op_composite);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,206 @@
+/// @file
+/// Test creation of a multigrid hierarchy for mass matrix operator
+/// \test Test creation of a multigrid hierarchy for mass matrix operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t502-operator.h"
+
+#define NUM_LEVELS 3
+
+// Compare two vectors entry by entry
+static void CompareVectors(const char *name, CeedInt level, CeedVector expected, CeedVector actual) {
+  CeedSize          length;
+  const CeedScalar *expected_array, *actual_array;
+
+  CeedVectorGetLength(expected, &length);
+  CeedVectorGetArrayRead(expected, CEED_MEM_HOST, &expected_array);
+  CeedVectorGetArrayRead(actual, CEED_MEM_HOST, &actual_array);
+  for (CeedSize i = 0; i < length; i++) {
+    if (fabs(expected_array[i] - actual_array[i]) > 100. * CEED_EPSILON) {
+      // LCOV_EXCL_START
+      printf("[%" CeedInt_FMT ", %" CeedSize_FMT "] %s %f != %f\n", level, i, name, actual_array[i], expected_array[i]);
+      // LCOV_EXCL_STOP
+    }
+  }
+  CeedVectorRestoreArrayRead(expected, &expected_array);
+  CeedVectorRestoreArrayRead(actual, &actual_array);
+}
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_q_data, elem_restriction_u[NUM_LEVELS + 1];
+  CeedBasis           basis_x, basis_u[NUM_LEVELS + 1];
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass_fine, op_coarse[NUM_LEVELS], op_prolong[NUM_LEVELS], op_restrict[NUM_LEVELS];
+  CeedOperator        op_coarse_level[NUM_LEVELS], op_prolong_level[NUM_LEVELS], op_restrict_level[NUM_LEVELS];
+  CeedVector          q_data, x;
+  CeedInt             num_elem = 15, p[NUM_LEVELS + 1] = {6, 5, 3, 2}, q = 8, num_comp = 2;
+  CeedInt             num_dofs_x = num_elem + 1, num_dofs_u[NUM_LEVELS + 1];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  {
+    CeedInt ind_x[num_elem * 2];
+
+    for (CeedInt i = 0; i < num_elem; i++) {
+      ind_x[2 * i + 0] = i;
+      ind_x[2 * i + 1] = i + 1;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_COPY_VALUES, ind_x, &elem_restriction_x);
+  }
+  for (CeedInt l = 0; l <= NUM_LEVELS; l++) {
+    CeedInt ind_u[num_elem * p[l]];
+
+    num_dofs_u[l] = num_elem * (p[l] - 1) + 1;
+    for (CeedInt i = 0; i < num_elem; i++) {
+      for (CeedInt j = 0; j < p[l]; j++) ind_u[p[l] * i + j] = i * (p[l] - 1) + j;
+    }
+    CeedElemRestrictionCreate(ceed, num_elem, p[l], num_comp, num_dofs_u[l], num_comp * num_dofs_u[l], CEED_MEM_HOST, CEED_COPY_VALUES, ind_u,
+                              &elem_restriction_u[l]);
+  }
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  for (CeedInt l = 0; l <= NUM_LEVELS; l++) CeedBasisCreateTensorH1Lagrange(ceed, 1, num_comp, p[l], q, CEED_GAUSS, &basis_u[l]);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1 * 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "q data", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", num_comp, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", num_comp, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "q data", elem_restriction_q_data, CEED_BASIS_NONE, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_fine);
+  CeedOperatorSetField(op_mass_fine, "q data", elem_restriction_q_data, CEED_BASIS_NONE, q_data);
+  CeedOperatorSetField(op_mass_fine, "u", elem_restriction_u[0], basis_u[0], CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_fine, "v", elem_restriction_u[0], basis_u[0], CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Create multigrid hierarchy in one call
+  CeedOperatorMultigridHierarchyCreate(op_mass_fine, NUM_LEVELS, NULL, &elem_restriction_u[1], &basis_u[1], op_coarse, op_prolong, op_restrict);
+
+  // Create the same hierarchy one level at a time
+  for (CeedInt l = 0; l < NUM_LEVELS; l++) {
+    CeedVector p_mult_fine;
+
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &p_mult_fine);
+    CeedVectorSetValue(p_mult_fine, 1.0);
+    CeedOperatorMultigridLevelCreate(l == 0 ? op_mass_fine : op_coarse_level[l - 1], p_mult_fine, elem_restriction_u[l + 1], basis_u[l + 1],
+                                     &op_coarse_level[l], &op_prolong_level[l], &op_restrict_level[l]);
+    CeedVectorDestroy(&p_mult_fine);
+  }
+
+  // Compare levels
+  for (CeedInt l = 0; l < NUM_LEVELS; l++) {
+    CeedVector u_coarse, u_fine, v_coarse, v_fine, v_coarse_level, v_fine_level;
+
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l + 1], &u_coarse);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l + 1], &v_coarse);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l + 1], &v_coarse_level);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &u_fine);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &v_fine);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[l], &v_fine_level);
+    {
+      CeedScalar *u_array;
+
+      CeedVectorGetArrayWrite(u_coarse, CEED_MEM_HOST, &u_array);
+      for (CeedInt i = 0; i < num_comp * num_dofs_u[l + 1]; i++) u_array[i] = sin(i + l);
+      CeedVectorRestoreArray(u_coarse, &u_array);
+      CeedVectorGetArrayWrite(u_fine, CEED_MEM_HOST, &u_array);
+      for (CeedInt i = 0; i < num_comp * num_dofs_u[l]; i++) u_array[i] = cos(i + l);
+      CeedVectorRestoreArray(u_fine, &u_array);
+    }
+
+    // -- Coarse operator
+    CeedOperatorApply(op_coarse[l], u_coarse, v_coarse, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_coarse_level[l], u_coarse, v_coarse_level, CEED_REQUEST_IMMEDIATE);
+    CompareVectors("coarse", l, v_coarse_level, v_coarse);
+
+    // -- Prolongation
+    CeedOperatorApply(op_prolong[l], u_coarse, v_fine, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_prolong_level[l], u_coarse, v_fine_level, CEED_REQUEST_IMMEDIATE);
+    CompareVectors("prolong", l, v_fine_level, v_fine);
+
+    // -- Restriction
+    CeedOperatorApply(op_restrict[l], u_fine, v_coarse, CEED_REQUEST_IMMEDIATE);
+    CeedOperatorApply(op_restrict_level[l], u_fine, v_coarse_level, CEED_REQUEST_IMMEDIATE);
+    CompareVectors("restrict", l, v_coarse_level, v_coarse);
+
+    CeedVectorDestroy(&u_coarse);
+    CeedVectorDestroy(&v_coarse);
+    CeedVectorDestroy(&v_coarse_level);
+    CeedVectorDestroy(&u_fine);
+    CeedVectorDestroy(&v_fine);
+    CeedVectorDestroy(&v_fine_level);
+  }
+
+  // Check coarsest level area
+  {
+    const CeedScalar *v_array;
+    CeedScalar        sum = 0.;
+    CeedVector        u_coarse, v_coarse;
+
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[NUM_LEVELS], &u_coarse);
+    CeedVectorCreate(ceed, num_comp * num_dofs_u[NUM_LEVELS], &v_coarse);
+    CeedVectorSetValue(u_coarse, 1.0);
+    CeedOperatorApply(op_coarse[NUM_LEVELS - 1], u_coarse, v_coarse, CEED_REQUEST_IMMEDIATE);
+    CeedVectorGetArrayRead(v_coarse, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_comp * num_dofs_u[NUM_LEVELS]; i++) sum += v_array[i];
+    CeedVectorRestoreArrayRead(v_coarse, &v_array);
+    if (fabs(sum - 2.) > 1000. * CEED_EPSILON) printf("Computed Area Coarsest Grid: %f != True Area: 2.0\n", sum);
+    CeedVectorDestroy(&u_coarse);
+    CeedVectorDestroy(&v_coarse);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  for (CeedInt l = 0; l <= NUM_LEVELS; l++) {
+    CeedElemRestrictionDestroy(&elem_restriction_u[l]);
+    CeedBasisDestroy(&basis_u[l]);
+  }
+  for (CeedInt l = 0; l < NUM_LEVELS; l++) {
+    CeedOperatorDestroy(&op_coarse[l]);
+    CeedOperatorDestroy(&op_prolong[l]);
+    CeedOperatorDestroy(&op_restrict[l]);
+    CeedOperatorDestroy(&op_coarse_level[l]);
+    CeedOperatorDestroy(&op_prolong_level[l]);
+    CeedOperatorDestroy(&op_restrict_level[l]);
+  }
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass_fine);
+  CeedDestroy(&ceed);
+  return 0;
+}